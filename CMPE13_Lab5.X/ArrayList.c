@@ -0,0 +1,306 @@
+/**
+ * @file
+ * This file provides an array-backed list of strings for read-heavy use. The list lives in
+ * parallel arrays of data pointers, cached lengths and 16-bit next and previous indices, so it
+ * needs no heap and its traversals walk contiguous memory.
+ */
+
+//Standard Libraries
+#include <stdio.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "ArrayList.h"
+#include "FastString.h"
+
+/**
+ * ArrayListCompare() orders the elements at indices first and second like LinkedListCompare()
+ * orders ListItems: NULL before every string, then shorter strings first, then alphabetically.
+ */
+static int ArrayListCompare(const ArrayList *list, uint16_t first, uint16_t second)
+{
+    const char *firstData = list->data[first];
+    const char *secondData = list->data[second];
+    if (firstData == secondData) {
+        return 0;
+    }
+    if (firstData == NULL) {
+        return -1;
+    }
+    if (secondData == NULL) {
+        return 1;
+    }
+    if (list->length[first] != list->length[second]) {
+        return (list->length[first] < list->length[second]) ? -1 : 1;
+    }
+    return FastStringCompare(firstData, secondData, list->length[first]);
+}
+
+/**
+ * ArrayListInit() sets up list as an empty list.
+ *
+ * @param list The list to initialize.
+ */
+void ArrayListInit(ArrayList *list)
+{
+    int i;
+    for (i = 0; i < ARRAY_LIST_CAPACITY - 1; i++) {
+        list->next[i] = i + 1;
+    }
+    list->next[ARRAY_LIST_CAPACITY - 1] = ARRAY_LIST_NONE;
+    list->unused = 0;
+    list->head = ARRAY_LIST_NONE;
+    list->tail = ARRAY_LIST_NONE;
+    list->size = 0;
+    list->sorted = TRUE;
+}
+
+/**
+ * ArrayListFromArray() fills list with the n strings of words, in order, replacing whatever it
+ * held before.
+ *
+ * @param list The list to fill.
+ * @param words The strings to store. Entries may be NULL.
+ * @param n The number of strings.
+ * @return SUCCESS or SIZE_ERROR if n is larger than ARRAY_LIST_CAPACITY.
+ */
+int ArrayListFromArray(ArrayList *list, char **words, int n)
+{
+    int i;
+    if (n > ARRAY_LIST_CAPACITY) {
+        return SIZE_ERROR;
+    }
+    ArrayListInit(list);
+    // A fresh list hands out slots in order, so element i simply lands in slot i.
+    for (i = 0; i < n; i++) {
+        ArrayListCreateAfter(list, list->tail, words[i]);
+    }
+    return SUCCESS;
+}
+
+/**
+ * ArrayListCreateAfter() stores data in a free slot and links it in after the element at index
+ * item, or at the head if item is ARRAY_LIST_NONE.
+ *
+ * @param list The list to add to.
+ * @param item The index of the element to insert after, or ARRAY_LIST_NONE.
+ * @param data The string to store. May be NULL.
+ * @return The index of the new element, or ARRAY_LIST_NONE if the list is full.
+ */
+uint16_t ArrayListCreateAfter(ArrayList *list, uint16_t item, char *data)
+{
+    uint16_t slot = list->unused;
+    if (slot == ARRAY_LIST_NONE) {
+        return ARRAY_LIST_NONE;
+    }
+    list->unused = list->next[slot];
+
+    list->data[slot] = data;
+    list->length[slot] = (data == NULL) ? 0 : FastStringLength(data);
+    list->previous[slot] = item;
+    list->next[slot] = (item == ARRAY_LIST_NONE) ? list->head : list->next[item];
+    if (list->next[slot] != ARRAY_LIST_NONE) {
+        list->previous[list->next[slot]] = slot;
+    } else {
+        list->tail = slot;
+    }
+    if (item != ARRAY_LIST_NONE) {
+        list->next[item] = slot;
+    } else {
+        list->head = slot;
+    }
+    list->size++;
+    list->sorted = FALSE;
+    return slot;
+}
+
+/**
+ * ArrayListRemove() unlinks the element at index item and gives its slot back.
+ *
+ * @param list The list to remove from.
+ * @param item The index of the element to remove.
+ * @return The data of the removed element, or NULL if item is ARRAY_LIST_NONE.
+ */
+char *ArrayListRemove(ArrayList *list, uint16_t item)
+{
+    if (item == ARRAY_LIST_NONE) {
+        return NULL;
+    }
+    uint16_t previous = list->previous[item];
+    uint16_t next = list->next[item];
+    if (previous != ARRAY_LIST_NONE) {
+        list->next[previous] = next;
+    } else {
+        list->head = next;
+    }
+    if (next != ARRAY_LIST_NONE) {
+        list->previous[next] = previous;
+    } else {
+        list->tail = previous;
+    }
+    list->next[item] = list->unused;
+    list->unused = item;
+    list->size--;
+    return list->data[item];
+}
+
+/**
+ * ArrayListSize() returns the number of elements in list. This is O(1).
+ *
+ * @param list The list.
+ * @return The number of elements, 0 if list is NULL.
+ */
+int ArrayListSize(const ArrayList *list)
+{
+    return (list == NULL) ? 0 : list->size;
+}
+
+/**
+ * ArrayListSort() sorts list in the same order as LinkedListSort(): NULL first, then by length and
+ * then alphabetically. It is the same stable bottom-up merge sort, running over the index arrays.
+ * Elements keep their indices; only the links change.
+ *
+ * @param list The list to sort.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL.
+ */
+int ArrayListSort(ArrayList *list)
+{
+    uint16_t head, left, right, tail, next;
+    int width, merges, leftSize, rightSize;
+
+    if (list == NULL) {
+        return STANDARD_ERROR;
+    }
+    if (list->sorted || list->head == ARRAY_LIST_NONE) {
+        list->sorted = TRUE;
+        return SUCCESS;
+    }
+    head = list->head;
+
+    // The merge loop of LinkedListMergeChain() in LinkedList.c, along the next indices.
+    for (width = 1;; width *= 2) {
+        left = head;
+        head = ARRAY_LIST_NONE;
+        tail = ARRAY_LIST_NONE;
+        merges = 0;
+        while (left != ARRAY_LIST_NONE) {
+            merges++;
+            right = left;
+            for (leftSize = 0; leftSize < width && right != ARRAY_LIST_NONE; leftSize++) {
+                right = list->next[right];
+            }
+            rightSize = width;
+            while (leftSize > 0 || (rightSize > 0 && right != ARRAY_LIST_NONE)) {
+                // Ties go to the left run.
+                if (leftSize == 0) {
+                    next = right;
+                    right = list->next[right];
+                    rightSize--;
+                } else if (rightSize == 0 || right == ARRAY_LIST_NONE ||
+                        ArrayListCompare(list, left, right) <= 0) {
+                    next = left;
+                    left = list->next[left];
+                    leftSize--;
+                } else {
+                    next = right;
+                    right = list->next[right];
+                    rightSize--;
+                }
+                if (tail == ARRAY_LIST_NONE) {
+                    head = next;
+                } else {
+                    list->next[tail] = next;
+                }
+                tail = next;
+            }
+            left = right;
+        }
+        list->next[tail] = ARRAY_LIST_NONE;
+        if (merges <= 1) {
+            break;
+        }
+    }
+
+    // Rebuild the previous indices from the next indices.
+    list->head = head;
+    list->previous[head] = ARRAY_LIST_NONE;
+    for (tail = head; list->next[tail] != ARRAY_LIST_NONE; tail = list->next[tail]) {
+        list->previous[list->next[tail]] = tail;
+    }
+    list->tail = tail;
+    list->sorted = TRUE;
+    return SUCCESS;
+}
+
+/**
+ * ArrayListSortedWordCount() does what SortedWordCount() in sort.c does for a sorted ArrayList:
+ * the first time a word appears its number of occurrences is stored, later copies get the negative
+ * of that number and NULL entries get 0. wordCount is filled in list order.
+ *
+ * @param list A list sorted with ArrayListSort().
+ * @param wordCount Room for at least ArrayListSize(list) counts.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL or not sorted.
+ */
+int ArrayListSortedWordCount(const ArrayList *list, int *wordCount)
+{
+    if (list == NULL || !list->sorted) {
+        return STANDARD_ERROR;
+    }
+    uint16_t item = list->head;
+    uint16_t runStart;
+    int i = 0;
+    int start, count;
+
+    while (item != ARRAY_LIST_NONE) {
+        // NULL words never start or extend a run.
+        if (list->data[item] == NULL) {
+            wordCount[i++] = 0;
+            item = list->next[item];
+            continue;
+        }
+
+        // Find the end of the run of words equal to this one.
+        runStart = item;
+        start = i;
+        do {
+            item = list->next[item];
+            i++;
+        } while (item != ARRAY_LIST_NONE && ArrayListCompare(list, runStart, item) == 0);
+
+        // Fill in the whole run at once.
+        count = i - start;
+        wordCount[start] = count;
+        for (start++; start < i; start++) {
+            wordCount[start] = -count;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * ArrayListPrint() prints list to stdout in the same format as LinkedListPrint().
+ *
+ * @param list The list to print.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL.
+ */
+int ArrayListPrint(const ArrayList *list)
+{
+    uint16_t item;
+    if (list == NULL) {
+        return STANDARD_ERROR;
+    }
+    fputs("{", stdout);
+    for (item = list->head; item != ARRAY_LIST_NONE; item = list->next[item]) {
+        if (list->data[item] == NULL) {
+            fputs("-(null)-", stdout);
+        } else {
+            fputs("-", stdout);
+            fwrite(list->data[item], 1, list->length[item], stdout);
+            fputs("-", stdout);
+        }
+    }
+    fputs("}\n", stdout);
+    return SUCCESS;
+}
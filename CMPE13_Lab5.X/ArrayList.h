@@ -0,0 +1,122 @@
+#ifndef ARRAYLIST_H
+#define ARRAYLIST_H
+
+/**
+ * @file
+ * This file provides an array-backed list of strings for read-heavy use. Instead of one heap node
+ * per word, the list is a set of parallel arrays inside the ArrayList struct: the data pointers,
+ * their cached lengths and 16-bit next and previous indices. Element i of the list is described by
+ * data[i], length[i], next[i] and previous[i], and ARRAY_LIST_NONE plays the part of NULL. Links
+ * cost 4 bytes per element instead of 8, there is no per-element heap overhead, and sorting,
+ * sizing and counting walk contiguous memory.
+ *
+ * The functions mirror their LinkedList counterparts, taking an ArrayList and an element index
+ * where those take a ListItem pointer. Indices stay valid until their element is removed.
+ */
+
+#include <stdint.h>
+
+/**
+ * The number of elements an ArrayList has room for. It must stay below ARRAY_LIST_NONE.
+ */
+#ifndef ARRAY_LIST_CAPACITY
+#define ARRAY_LIST_CAPACITY 64
+#endif
+
+/**
+ * The index that marks the end of the list, like NULL does for ListItems.
+ */
+#define ARRAY_LIST_NONE 0xFFFF
+
+/**
+ * An array-backed list. Unused slots are chained through next starting at unused. Lengths are
+ * cached in 16 bits, so strings must be shorter than 65536 characters.
+ */
+typedef struct ArrayList {
+	char *data[ARRAY_LIST_CAPACITY];
+	uint16_t length[ARRAY_LIST_CAPACITY];
+	uint16_t next[ARRAY_LIST_CAPACITY];
+	uint16_t previous[ARRAY_LIST_CAPACITY];
+	uint16_t head;
+	uint16_t tail;
+	uint16_t unused;
+	int size;
+	int sorted;
+} ArrayList;
+
+/**
+ * ArrayListInit() sets up list as an empty list.
+ *
+ * @param list The list to initialize.
+ */
+void ArrayListInit(ArrayList *list);
+
+/**
+ * ArrayListFromArray() fills list with the n strings of words, in order, replacing whatever it
+ * held before.
+ *
+ * @param list The list to fill.
+ * @param words The strings to store. Entries may be NULL.
+ * @param n The number of strings.
+ * @return SUCCESS or SIZE_ERROR if n is larger than ARRAY_LIST_CAPACITY.
+ */
+int ArrayListFromArray(ArrayList *list, char **words, int n);
+
+/**
+ * ArrayListCreateAfter() stores data in a free slot and links it in after the element at index
+ * item, or at the head if item is ARRAY_LIST_NONE.
+ *
+ * @param list The list to add to.
+ * @param item The index of the element to insert after, or ARRAY_LIST_NONE.
+ * @param data The string to store. May be NULL.
+ * @return The index of the new element, or ARRAY_LIST_NONE if the list is full.
+ */
+uint16_t ArrayListCreateAfter(ArrayList *list, uint16_t item, char *data);
+
+/**
+ * ArrayListRemove() unlinks the element at index item and gives its slot back.
+ *
+ * @param list The list to remove from.
+ * @param item The index of the element to remove.
+ * @return The data of the removed element, or NULL if item is ARRAY_LIST_NONE.
+ */
+char *ArrayListRemove(ArrayList *list, uint16_t item);
+
+/**
+ * ArrayListSize() returns the number of elements in list. This is O(1).
+ *
+ * @param list The list.
+ * @return The number of elements, 0 if list is NULL.
+ */
+int ArrayListSize(const ArrayList *list);
+
+/**
+ * ArrayListSort() sorts list in the same order as LinkedListSort(): NULL first, then by length and
+ * then alphabetically. It is the same stable bottom-up merge sort, running over the index arrays.
+ * Elements keep their indices; only the links change.
+ *
+ * @param list The list to sort.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL.
+ */
+int ArrayListSort(ArrayList *list);
+
+/**
+ * ArrayListSortedWordCount() does what SortedWordCount() in sort.c does for a sorted ArrayList:
+ * the first time a word appears its number of occurrences is stored, later copies get the negative
+ * of that number and NULL entries get 0. wordCount is filled in list order.
+ *
+ * @param list A list sorted with ArrayListSort().
+ * @param wordCount Room for at least ArrayListSize(list) counts.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL or not sorted.
+ */
+int ArrayListSortedWordCount(const ArrayList *list, int *wordCount);
+
+/**
+ * ArrayListPrint() prints list to stdout in the same format as LinkedListPrint().
+ *
+ * @param list The list to print.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL.
+ */
+int ArrayListPrint(const ArrayList *list);
+
+#endif
@@ -0,0 +1,174 @@
+/**
+ * @file
+ * This file is a cycle-count benchmark for the LinkedList library and the word counting functions
+ * in sort.c. It replaces the main() in sort.c when LINKED_LIST_BENCHMARK is defined, so a benchmark
+ * build is the default configuration with that one macro added: in MPLAB X, duplicate the
+ * "default" configuration as "benchmark" and add LINKED_LIST_BENCHMARK to its XC32 preprocessor
+ * macros. The heap has to be raised from 1024 bytes for the larger list sizes to fit, any size that
+ * does not fit is reported as skipped.
+ *
+ * For every list size it builds a list of pseudo-random words (always the same ones, the generator
+ * has a fixed seed) and times each operation with the core timer. The results are printed over the
+ * UART, one line per measurement, in the form
+ *     BENCH,<operation>,<list size>,<cycles>,<cycles per element>
+ * Everything else that is printed (such as the output of LinkedListPrint()) does not start with
+ * "BENCH," and can be ignored by whatever parses the results.
+ */
+
+#ifdef LINKED_LIST_BENCHMARK
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// Microchip libraries
+#include <xc.h>
+#include <plib.h>
+
+// User libraries
+#include "LinkedList.h"
+
+// **** Set any macros or preprocessor directives here ****
+// The core timer (CP0 Count) ticks once every two system clock cycles.
+#define BENCHMARK_CYCLES() (2 * (uint32_t) _CP0_GET_COUNT())
+
+// The longest word the generator produces, and how many different letters it uses. A small alphabet
+// makes sure short words repeat, so the word counts have duplicates to find.
+#define BENCHMARK_MAX_WORD_LENGTH 6
+#define BENCHMARK_ALPHABET_SIZE 8
+
+// UnsortedWordCount() is quadratic, so it is only run up to this list size.
+#define BENCHMARK_QUADRATIC_LIMIT 1000
+
+// **** Define any module-level, global, or external variables here ****
+static const int benchmarkSizes[] = {10, 32, 100, 316, 1000, 3162, 10000};
+static uint32_t randomState = 2463534242u;
+
+// **** Declare any function prototypes here ****
+int UnsortedWordCount(ListItem *list, int *wordCount);
+int UnsortedWordCountHashed(ListItem *list, int *wordCount);
+int SortedWordCount(ListItem *list, int *wordCount);
+
+/**
+ * BenchmarkRandom() is a xorshift32 pseudo-random number generator. Unlike rand(), which
+ * BOARD_Init() seeds from the build time, its sequence is the same on every run.
+ */
+static uint32_t BenchmarkRandom(void)
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+/**
+ * BenchmarkReport() prints one result line.
+ */
+static void BenchmarkReport(const char *operation, int n, uint32_t cycles)
+{
+    printf("BENCH,%s,%d,%lu,%lu\n", operation, n, (unsigned long) cycles,
+            (unsigned long) (cycles / n));
+}
+
+/**
+ * BenchmarkRun() generates n words and times every operation on them. It returns STANDARD_ERROR
+ * if the words, the list or the count array do not fit in the heap.
+ */
+static int BenchmarkRun(int n)
+{
+    char *letters = malloc(n * (BENCHMARK_MAX_WORD_LENGTH + 1));
+    char **words = malloc(n * sizeof (char *));
+    int *wordCount = malloc(n * sizeof (int));
+    uint32_t start;
+    int i, j, length;
+
+    if (letters == NULL || words == NULL || wordCount == NULL) {
+        free(letters);
+        free(words);
+        free(wordCount);
+        return STANDARD_ERROR;
+    }
+    for (i = 0; i < n; i++) {
+        words[i] = &letters[i * (BENCHMARK_MAX_WORD_LENGTH + 1)];
+        length = 1 + BenchmarkRandom() % BENCHMARK_MAX_WORD_LENGTH;
+        for (j = 0; j < length; j++) {
+            words[i][j] = 'a' + BenchmarkRandom() % BENCHMARK_ALPHABET_SIZE;
+        }
+        words[i][length] = '\0';
+    }
+    ListItem *block = LinkedListFromArray(words, n);
+    if (block == NULL) {
+        free(letters);
+        free(words);
+        free(wordCount);
+        return STANDARD_ERROR;
+    }
+
+    start = BENCHMARK_CYCLES();
+    LinkedListSize(&block[n / 2]);
+    BenchmarkReport("LinkedListSize", n, BENCHMARK_CYCLES() - start);
+
+    if (n <= BENCHMARK_QUADRATIC_LIMIT) {
+        start = BENCHMARK_CYCLES();
+        UnsortedWordCount(block, wordCount);
+        BenchmarkReport("UnsortedWordCount", n, BENCHMARK_CYCLES() - start);
+    }
+
+    start = BENCHMARK_CYCLES();
+    UnsortedWordCountHashed(block, wordCount);
+    BenchmarkReport("UnsortedWordCountHashed", n, BENCHMARK_CYCLES() - start);
+
+    start = BENCHMARK_CYCLES();
+    LinkedListSort(block);
+    BenchmarkReport("LinkedListSort", n, BENCHMARK_CYCLES() - start);
+
+    // LinkedListSortRadix() needs a second unsorted copy of the list, skip it if there is no room.
+    ListItem *copy = LinkedListFromArray(words, n);
+    if (copy != NULL) {
+        start = BENCHMARK_CYCLES();
+        LinkedListSortRadix(copy);
+        BenchmarkReport("LinkedListSortRadix", n, BENCHMARK_CYCLES() - start);
+        LinkedListFreeArray(copy, n);
+    }
+
+    ListItem *head = LinkedListGetFirst(block);
+    start = BENCHMARK_CYCLES();
+    SortedWordCount(head, wordCount);
+    BenchmarkReport("SortedWordCount", n, BENCHMARK_CYCLES() - start);
+
+    start = BENCHMARK_CYCLES();
+    LinkedListPrint(head);
+    BenchmarkReport("LinkedListPrint", n, BENCHMARK_CYCLES() - start);
+
+    LinkedListFreeArray(block, n);
+    free(letters);
+    free(words);
+    free(wordCount);
+    return SUCCESS;
+}
+
+int main()
+{
+    BOARD_Init();
+
+    unsigned int i;
+    printf("BENCH,operation,n,cycles,cycles_per_element\n");
+    for (i = 0; i < sizeof (benchmarkSizes) / sizeof (benchmarkSizes[0]); i++) {
+        if (BenchmarkRun(benchmarkSizes[i]) != SUCCESS) {
+            printf("BENCH,SKIPPED,%d,0,0\n", benchmarkSizes[i]);
+        }
+    }
+    printf("BENCH,DONE,0,0,0\n");
+    // Totals over the whole run when built with LINKED_LIST_STATS.
+    LinkedListStatsDump();
+
+    // You can never return from main() in an embedded system (one that lacks an operating system).
+    while (1);
+}
+
+#endif
@@ -0,0 +1,88 @@
+/**
+ * @file
+ * This file provides a fixed vocabulary that is known at build time, stored sorted in a const
+ * table generated by gen_dictionary.py. The table itself is in DictionaryData.c.
+ */
+
+//Standard Libraries
+#include <stdio.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "Dictionary.h"
+#include "FastString.h"
+
+/**
+ * DictionaryFind() looks word up with a binary search over the sorted table.
+ *
+ * @param word The word to look for. May be NULL.
+ * @return The id of word, or 0 if it is not in the dictionary.
+ */
+int DictionaryFind(const char *word)
+{
+    if (word == NULL) {
+        return 0;
+    }
+    unsigned int length = FastStringLength(word);
+    int low = 0;
+    int high = dictionarySize - 1;
+    int middle, order;
+
+    // The table is ordered by length first, then by content.
+    while (low <= high) {
+        middle = (low + high) / 2;
+        if (dictionary[middle].length != length) {
+            order = (dictionary[middle].length < length) ? -1 : 1;
+        } else {
+            order = FastStringCompare(dictionary[middle].word, word, length);
+        }
+        if (order == 0) {
+            return dictionary[middle].id;
+        } else if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * DictionaryBuildList() makes list hold counts[i] copies of dictionary word i + 1 for every word,
+ * in table order, so the list is sorted and marked as such without LinkedListSort() ever running.
+ * The ListItems point straight at the strings in the table, which must never be written to or
+ * passed to free(), and take their length and sort key from it too.
+ *
+ * The dictionary ids are not the ListItem.wordId of the words: those are LINKED_LIST_INTERN ids,
+ * handed out in the order words are first interned and 0 without interning. Use DictionaryFind()
+ * to get from a ListItem to its dictionary id.
+ *
+ * @param list The header to build the list under. Whatever it tracked before is forgotten.
+ * @param counts How many copies of each word to add, dictionarySize entries.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers or a ListItem could not be
+ *         allocated, in which case list holds the words added so far.
+ */
+int DictionaryBuildList(LinkedList *list, const int *counts)
+{
+    int i, copy;
+    if (list == NULL || counts == NULL) {
+        return STANDARD_ERROR;
+    }
+    LinkedListInit(list);
+    for (i = 0; i < dictionarySize; i++) {
+        for (copy = 0; copy < counts[i]; copy++) {
+            if (LinkedListAppend(list, NULL) == NULL) {
+                list->sorted = TRUE;
+                return STANDARD_ERROR;
+            }
+            LinkedListSetKnownData(list->tail, (char *) dictionary[i].word, dictionary[i].length,
+                    dictionary[i].sortKey);
+        }
+    }
+    // Appending clears the flag, but the table order is the sorted order.
+    list->sorted = TRUE;
+    return SUCCESS;
+}
@@ -0,0 +1,61 @@
+#ifndef DICTIONARY_H
+#define DICTIONARY_H
+
+/**
+ * @file
+ * This file provides a fixed vocabulary that is known at build time. The words live in a const
+ * table, which XC32 keeps in flash, generated by gen_dictionary.py into DictionaryData.c:
+ *
+ *     python3 gen_dictionary.py dog pig cow cat turtle bird crab > DictionaryData.c
+ *
+ * The table is already sorted the way LinkedListSort() sorts, and stores the length, sort key and
+ * id of every word, so nothing about it has to be computed at runtime. Lists built from it with
+ * DictionaryBuildList() start out sorted, point at the strings in flash instead of copies in RAM,
+ * and are interned as they are built when LINKED_LIST_INTERN is defined.
+ */
+
+#include "LinkedList.h"
+
+/**
+ * One word of the dictionary. ids count up from 1 in table order, so 0 can mean "not a word".
+ * sortKey is the ListItem.sortKey of the word, see LinkedListSetKnownData().
+ */
+typedef struct DictionaryWord {
+	const char *word;
+	unsigned short length;
+	unsigned short id;
+	uint32_t sortKey;
+} DictionaryWord;
+
+/**
+ * The generated table and its number of words, in sorted order. dictionary[i].id is i + 1.
+ */
+extern const DictionaryWord dictionary[];
+extern const int dictionarySize;
+
+/**
+ * DictionaryFind() looks word up with a binary search over the sorted table.
+ *
+ * @param word The word to look for. May be NULL.
+ * @return The id of word, or 0 if it is not in the dictionary.
+ */
+int DictionaryFind(const char *word);
+
+/**
+ * DictionaryBuildList() makes list hold counts[i] copies of dictionary word i + 1 for every word,
+ * in table order, so the list is sorted and marked as such without LinkedListSort() ever running.
+ * The ListItems point straight at the strings in the table, which must never be written to or
+ * passed to free(), and take their length and sort key from it too.
+ *
+ * The dictionary ids are not the ListItem.wordId of the words: those are LINKED_LIST_INTERN ids,
+ * handed out in the order words are first interned and 0 without interning. Use DictionaryFind()
+ * to get from a ListItem to its dictionary id.
+ *
+ * @param list The header to build the list under. Whatever it tracked before is forgotten.
+ * @param counts How many copies of each word to add, dictionarySize entries.
+ * @return SUCCESS, or STANDARD_ERROR if passed NULL pointers or a ListItem could not be
+ *         allocated, in which case list holds the words added so far.
+ */
+int DictionaryBuildList(LinkedList *list, const int *counts);
+
+#endif
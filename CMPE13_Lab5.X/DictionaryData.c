@@ -0,0 +1,19 @@
+/**
+ * @file
+ * Generated by gen_dictionary.py, do not edit. This is the word table declared in
+ * Dictionary.h, sorted the way LinkedListSort() sorts.
+ */
+
+#include "Dictionary.h"
+
+const DictionaryWord dictionary[] = {
+    {"cat", 3, 1, 0x04636174u},
+    {"cow", 3, 2, 0x04636F77u},
+    {"dog", 3, 3, 0x04646F67u},
+    {"pig", 3, 4, 0x04706967u},
+    {"bird", 4, 5, 0x05626972u},
+    {"crab", 4, 6, 0x05637261u},
+    {"turtle", 6, 7, 0x07747572u},
+};
+
+const int dictionarySize = 7;
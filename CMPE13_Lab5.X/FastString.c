@@ -0,0 +1,89 @@
+/**
+ * @file
+ * This file provides the string length and compare kernels used by the sort and word count hot
+ * paths instead of the libc functions, which XC32 implements a byte at a time.
+ */
+
+//Standard Libraries
+#include <stdint.h>
+
+// User libraries
+#include "FastString.h"
+
+// **** Set any macros or preprocessor directives here ****
+// Non-zero if the 32-bit word has a zero byte: only a zero byte borrows into its own top bit when
+// 1 is subtracted from every byte.
+#define HAS_ZERO_BYTE(word) (((word) - 0x01010101u) & ~(word) & 0x80808080u)
+
+// **** Declare any data types here ****
+// A word that may alias the chars it is read from.
+typedef uint32_t __attribute__((may_alias)) StringWord;
+
+/**
+ * FastStringLength() returns the length of str, like strlen(). Once str is aligned it reads whole
+ * aligned words and finds the terminating zero byte with a bit trick, so it may read up to 3 bytes
+ * past the terminator, never past the aligned word that holds it.
+ *
+ * @param str The string to measure. Must not be NULL.
+ * @return The number of characters before the terminating zero.
+ */
+unsigned int FastStringLength(const char *str)
+{
+    const char *end = str;
+
+    // Go a byte at a time up to the first word boundary.
+    while (((uintptr_t) end & 3) != 0) {
+        if (*end == '\0') {
+            return end - str;
+        }
+        end++;
+    }
+    const StringWord *word = (const StringWord *) end;
+    while (!HAS_ZERO_BYTE(*word)) {
+        word++;
+    }
+    // The zero is in this word, find which byte it is.
+    for (end = (const char *) word; *end != '\0'; end++);
+    return end - str;
+}
+
+/**
+ * FastStringCompare() compares the first length characters of first and second, like memcmp().
+ * This is what strcmp() reduces to for strings already known to have the same length, which is
+ * the case everywhere the list code compares contents. It never reads past length characters.
+ *
+ * @param first The left-hand side of the comparison.
+ * @param second The right-hand side of the comparison.
+ * @param length The number of characters to compare.
+ * @return A negative number, zero or a positive number if first sorts before, together with or
+ *         after second.
+ */
+int FastStringCompare(const char *first, const char *second, unsigned int length)
+{
+    const unsigned char *a = (const unsigned char *) first;
+    const unsigned char *b = (const unsigned char *) second;
+
+    // Whole words only work if both strings reach a word boundary at the same time.
+    if ((((uintptr_t) a ^ (uintptr_t) b) & 3) == 0) {
+        while (length > 0 && ((uintptr_t) a & 3) != 0) {
+            if (*a != *b) {
+                return *a - *b;
+            }
+            a++;
+            b++;
+            length--;
+        }
+        // Skip equal words; the bytes of the first differing one are compared below.
+        while (length >= 4 && *(const StringWord *) a == *(const StringWord *) b) {
+            a += 4;
+            b += 4;
+            length -= 4;
+        }
+    }
+    for (; length > 0; a++, b++, length--) {
+        if (*a != *b) {
+            return *a - *b;
+        }
+    }
+    return 0;
+}
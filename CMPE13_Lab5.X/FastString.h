@@ -0,0 +1,35 @@
+#ifndef FASTSTRING_H
+#define FASTSTRING_H
+
+/**
+ * @file
+ * This file provides the string length and compare kernels used by the sort and word count hot
+ * paths instead of the libc functions, which XC32 implements a byte at a time. Where both strings
+ * are equally aligned they work on 4 bytes per iteration, and otherwise fall back to one byte at a
+ * time.
+ */
+
+/**
+ * FastStringLength() returns the length of str, like strlen(). Once str is aligned it reads whole
+ * aligned words and finds the terminating zero byte with a bit trick, so it may read up to 3 bytes
+ * past the terminator, never past the aligned word that holds it.
+ *
+ * @param str The string to measure. Must not be NULL.
+ * @return The number of characters before the terminating zero.
+ */
+unsigned int FastStringLength(const char *str);
+
+/**
+ * FastStringCompare() compares the first length characters of first and second, like memcmp().
+ * This is what strcmp() reduces to for strings already known to have the same length, which is
+ * the case everywhere the list code compares contents. It never reads past length characters.
+ *
+ * @param first The left-hand side of the comparison.
+ * @param second The right-hand side of the comparison.
+ * @param length The number of characters to compare.
+ * @return A negative number, zero or a positive number if first sorts before, together with or
+ *         after second.
+ */
+int FastStringCompare(const char *first, const char *second, unsigned int length);
+
+#endif
@@ -0,0 +1,190 @@
+/**
+ * @file
+ * This file provides an intrusive doubly-linked list for records of any type. A ListNode is
+ * embedded in every record and LIST_NODE_ENTRY() gets from a node back to its record.
+ */
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "IntrusiveList.h"
+
+/**
+ * ListNodeInit() turns node into a list of one element. Call it on every node before its first
+ * use, for example when the record is created.
+ *
+ * @param node The node to initialize.
+ */
+void ListNodeInit(ListNode *node)
+{
+    node->previous = NULL;
+    node->next = NULL;
+}
+
+/**
+ * ListNodeInsertAfter() links newNode into the list after node. newNode must not be in any list;
+ * if node is NULL newNode just becomes a list of one element.
+ *
+ * @param node The node to insert after. May be NULL.
+ * @param newNode The node to insert.
+ * @return SUCCESS or STANDARD_ERROR if newNode is NULL.
+ */
+int ListNodeInsertAfter(ListNode *node, ListNode *newNode)
+{
+    if (newNode == NULL) {
+        return STANDARD_ERROR;
+    }
+    newNode->previous = node;
+    if (node == NULL) {
+        newNode->next = NULL;
+        return SUCCESS;
+    }
+    newNode->next = node->next;
+    if (node->next != NULL) {
+        node->next->previous = newNode;
+    }
+    node->next = newNode;
+    return SUCCESS;
+}
+
+/**
+ * ListNodeRemove() unlinks node from its list and leaves it as a list of one element. The record
+ * it is embedded in is not touched otherwise.
+ *
+ * @param node The node to remove.
+ * @return SUCCESS or STANDARD_ERROR if node is NULL.
+ */
+int ListNodeRemove(ListNode *node)
+{
+    if (node == NULL) {
+        return STANDARD_ERROR;
+    }
+    if (node->previous != NULL) {
+        node->previous->next = node->next;
+    }
+    if (node->next != NULL) {
+        node->next->previous = node->previous;
+    }
+    ListNodeInit(node);
+    return SUCCESS;
+}
+
+/**
+ * ListNodeGetFirst() returns the first node of the list node belongs to.
+ *
+ * @param node Any node of the list.
+ * @return The first node or NULL if node is NULL.
+ */
+ListNode *ListNodeGetFirst(ListNode *node)
+{
+    if (node == NULL) {
+        return NULL;
+    }
+    while (node->previous != NULL) {
+        node = node->previous;
+    }
+    return node;
+}
+
+/**
+ * ListNodeGetLast() returns the last node of the list node belongs to.
+ *
+ * @param node Any node of the list.
+ * @return The last node or NULL if node is NULL.
+ */
+ListNode *ListNodeGetLast(ListNode *node)
+{
+    if (node == NULL) {
+        return NULL;
+    }
+    while (node->next != NULL) {
+        node = node->next;
+    }
+    return node;
+}
+
+/**
+ * ListNodeSize() counts the nodes of the list node belongs to.
+ *
+ * @param node Any node of the list.
+ * @return The number of nodes, 0 if node is NULL.
+ */
+int ListNodeSize(ListNode *node)
+{
+    int size = 0;
+    for (node = ListNodeGetFirst(node); node != NULL; node = node->next) {
+        size++;
+    }
+    return size;
+}
+
+/**
+ * ListNodeSort() sorts the list node belongs to into ascending order with a bottom-up merge sort,
+ * the same one LinkedListSort() uses. Equal records keep their order. Nodes are relinked, not
+ * copied, so use the return value to find the new first node.
+ *
+ * @param node Any node of the list.
+ * @param compare Orders the records the nodes are embedded in.
+ * @return The new first node, or NULL if node or compare is NULL.
+ */
+ListNode *ListNodeSort(ListNode *node, ListNodeCompareFunction compare)
+{
+    ListNode *head, *left, *right, *tail, *next;
+    int width, merges, leftSize, rightSize;
+
+    if (node == NULL || compare == NULL) {
+        return NULL;
+    }
+    head = ListNodeGetFirst(node);
+
+    // The merge loop of LinkedListMergeChain() in LinkedList.c, along the next links.
+    for (width = 1;; width *= 2) {
+        left = head;
+        head = NULL;
+        tail = NULL;
+        merges = 0;
+        while (left != NULL) {
+            merges++;
+            right = left;
+            for (leftSize = 0; leftSize < width && right != NULL; leftSize++) {
+                right = right->next;
+            }
+            rightSize = width;
+            while (leftSize > 0 || (rightSize > 0 && right != NULL)) {
+                // Ties go to the left run.
+                if (leftSize == 0) {
+                    next = right;
+                    right = right->next;
+                    rightSize--;
+                } else if (rightSize == 0 || right == NULL || compare(left, right) <= 0) {
+                    next = left;
+                    left = left->next;
+                    leftSize--;
+                } else {
+                    next = right;
+                    right = right->next;
+                    rightSize--;
+                }
+                if (tail == NULL) {
+                    head = next;
+                } else {
+                    tail->next = next;
+                }
+                tail = next;
+            }
+            left = right;
+        }
+        tail->next = NULL;
+        if (merges <= 1) {
+            break;
+        }
+    }
+
+    // Rebuild the previous links from the next links.
+    head->previous = NULL;
+    for (tail = head; tail->next != NULL; tail = tail->next) {
+        tail->next->previous = tail;
+    }
+    return head;
+}
@@ -0,0 +1,108 @@
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+
+/**
+ * @file
+ * This file provides an intrusive doubly-linked list for records of any type. Instead of a ListItem
+ * pointing at separately allocated data, a ListNode is embedded in the record itself and the list
+ * links the records directly:
+ *
+ *     typedef struct {
+ *         int count;
+ *         ListNode node;
+ *         char word[8];
+ *     } Record;
+ *
+ *     Record *record = LIST_NODE_ENTRY(node, Record, node);
+ *
+ * A record and its links then take one allocation (or none, for static records) and sit next to
+ * each other in memory. The list never allocates or frees anything itself, the caller owns every
+ * record. A record can be in as many lists at once as it has ListNodes.
+ */
+
+#include <stddef.h>
+
+/**
+ * LIST_NODE_ENTRY() returns a pointer to the record of type type that node is embedded in as
+ * member.
+ */
+#define LIST_NODE_ENTRY(node, type, member) ((type *) ((char *) (node) - offsetof(type, member)))
+
+/**
+ * The links embedded in every record. As with ListItem, there is no separate list struct: any node
+ * identifies the list it belongs to.
+ */
+typedef struct ListNode {
+	struct ListNode *previous;
+	struct ListNode *next;
+} ListNode;
+
+/**
+ * Compares the records two nodes are embedded in, returning a negative number, zero or a positive
+ * number if the first sorts before, together with or after the second, like strcmp().
+ */
+typedef int (*ListNodeCompareFunction)(const ListNode *first, const ListNode *second);
+
+/**
+ * ListNodeInit() turns node into a list of one element. Call it on every node before its first
+ * use, for example when the record is created.
+ *
+ * @param node The node to initialize.
+ */
+void ListNodeInit(ListNode *node);
+
+/**
+ * ListNodeInsertAfter() links newNode into the list after node. newNode must not be in any list;
+ * if node is NULL newNode just becomes a list of one element.
+ *
+ * @param node The node to insert after. May be NULL.
+ * @param newNode The node to insert.
+ * @return SUCCESS or STANDARD_ERROR if newNode is NULL.
+ */
+int ListNodeInsertAfter(ListNode *node, ListNode *newNode);
+
+/**
+ * ListNodeRemove() unlinks node from its list and leaves it as a list of one element. The record
+ * it is embedded in is not touched otherwise.
+ *
+ * @param node The node to remove.
+ * @return SUCCESS or STANDARD_ERROR if node is NULL.
+ */
+int ListNodeRemove(ListNode *node);
+
+/**
+ * ListNodeGetFirst() returns the first node of the list node belongs to.
+ *
+ * @param node Any node of the list.
+ * @return The first node or NULL if node is NULL.
+ */
+ListNode *ListNodeGetFirst(ListNode *node);
+
+/**
+ * ListNodeGetLast() returns the last node of the list node belongs to.
+ *
+ * @param node Any node of the list.
+ * @return The last node or NULL if node is NULL.
+ */
+ListNode *ListNodeGetLast(ListNode *node);
+
+/**
+ * ListNodeSize() counts the nodes of the list node belongs to.
+ *
+ * @param node Any node of the list.
+ * @return The number of nodes, 0 if node is NULL.
+ */
+int ListNodeSize(ListNode *node);
+
+/**
+ * ListNodeSort() sorts the list node belongs to into ascending order with a bottom-up merge sort,
+ * the same one LinkedListSort() uses. Equal records keep their order. Nodes are relinked, not
+ * copied, so use the return value to find the new first node.
+ *
+ * @param node Any node of the list.
+ * @param compare Orders the records the nodes are embedded in.
+ * @return The new first node, or NULL if node or compare is NULL.
+ */
+ListNode *ListNodeSort(ListNode *node, ListNodeCompareFunction compare);
+
+#endif
@@ -11,6 +11,7 @@
 
 //Standard Libraries
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 
@@ -23,8 +24,224 @@
 
 // User libraries
 #include "LinkedList.h"
+#include "UartQueue.h"
+#include "WordTable.h"
+#include "FastString.h"
 
+// **** Set any macros or preprocessor directives here ****
+// Values for ListItem.flags
+#define LIST_ITEM_BLOCK    0x01 // The item is part of a LinkedListFromArray() block
+#define LIST_ITEM_RELEASED 0x02 // The item is part of a block and has been removed from its list
 
+// The longest string whose length fits into the top byte of a sort key.
+#define SORT_KEY_MAX_LENGTH 253
+
+// ListItem.wordId holds the intern table ids, which count up to three quarters of its capacity.
+#if defined(LINKED_LIST_INTERN) && WORD_TABLE_CAPACITY - WORD_TABLE_CAPACITY / 4 > 65535
+#error "WORD_TABLE_CAPACITY is too large for the 16-bit ListItem.wordId used by LINKED_LIST_INTERN"
+#endif
+
+// The phases of a LinkedListSortState: set up the next merge, find where its right run starts,
+// merge the two runs, rebuild the previousItem links and finished.
+#define SORT_PHASE_START 0
+#define SORT_PHASE_SCAN 1
+#define SORT_PHASE_MERGE 2
+#define SORT_PHASE_RELINK 3
+#define SORT_PHASE_DONE 4
+
+// The phases of a LinkedListPrintState: the opening brace, the items, the closing brace and
+// finished.
+#define PRINT_PHASE_OPEN 0
+#define PRINT_PHASE_ITEMS 1
+#define PRINT_PHASE_CLOSE 2
+#define PRINT_PHASE_DONE 3
+
+// Counter updates for LINKED_LIST_STATS, see LinkedListStatsDump(). They vanish without it.
+#ifdef LINKED_LIST_STATS
+#define STATS_ADD(field, n) (hotStats.field += (n))
+#define STATS_LIVE(n) do { \
+        hotStats.live += (n); \
+        if (hotStats.live > hotStats.peakLive) { \
+            hotStats.peakLive = hotStats.live; \
+        } \
+    } while (0)
+#else
+#define STATS_ADD(field, n)
+#define STATS_LIVE(n)
+#endif
+
+// **** Declare any data types here ****
+// A buffer that LinkedListFormat() fills and hands to flush whenever it is full.
+typedef struct PrintBuffer {
+    char *buffer;
+    int size;
+    int used;
+    int (*flush)(const char *text, int length);
+} PrintBuffer;
+
+// **** Define any module-level, global, or external variables here ****
+#if LINKED_LIST_POOL_SIZE > 0
+// Statically allocated ListItems. Nodes that have been handed out and returned again are kept on
+// a free list chained through nextItem; nodes past poolUnused have never been used at all.
+static ListItem nodePool[LINKED_LIST_POOL_SIZE];
+static ListItem *freeItems = NULL;
+static int poolUnused = 0;
+#endif
+static char printBuffer[LINKED_LIST_PRINT_BUFFER_SIZE];
+#ifdef LINKED_LIST_INTERN
+// Every distinct string stored in a ListItem, see LinkedListSetData().
+static WordTable internTable;
+static int internTableReady = FALSE;
+// The intern table entry of every wordId, for the online word counts, see LinkedListWordCount().
+static WordTableEntry *internEntries[WORD_TABLE_CAPACITY];
+#endif
+static LinkedListPoolStats poolStats = {LINKED_LIST_POOL_SIZE, 0, 0, 0, 0, 0};
+#ifdef LINKED_LIST_STATS
+static LinkedListStats hotStats;
+#endif
+
+#ifdef LINKED_LIST_INTERN
+/**
+ * LinkedListUncount() takes item out of the online count of its word, see LinkedListWordCount().
+ */
+static void LinkedListUncount(const ListItem *item)
+{
+    if (item->wordId != 0) {
+        WordTableEntry *entry = internEntries[item->wordId];
+        entry->count--;
+        if (entry->firstItem == item) {
+            entry->firstItem = NULL;
+        }
+    }
+}
+
+/**
+ * LinkedListForgetFirst() marks the first occurrence of the word in item as unknown, so that
+ * LinkedListWordCount() looks for it again the next time it is needed.
+ */
+static void LinkedListForgetFirst(const ListItem *item)
+{
+    if (item->wordId != 0) {
+        internEntries[item->wordId]->firstItem = NULL;
+    }
+}
+#endif
+
+/**
+ * LinkedListHeapAlloc() is malloc() charged against LINKED_LIST_HEAP_SIZE in poolStats.heapBytes.
+ */
+static void *LinkedListHeapAlloc(size_t size)
+{
+    void *memory = malloc(size);
+    if (memory != NULL) {
+        poolStats.heapBytes += size + LINKED_LIST_HEAP_OVERHEAD;
+    }
+    return memory;
+}
+
+/**
+ * LinkedListHeapFree() is free() for memory from LinkedListHeapAlloc() of the same size.
+ */
+static void LinkedListHeapFree(void *memory, size_t size)
+{
+    free(memory);
+    poolStats.heapBytes -= size + LINKED_LIST_HEAP_OVERHEAD;
+}
+
+/**
+ * LinkedListInPool() checks whether item is one of the ListItems in the node pool.
+ */
+static int LinkedListInPool(const ListItem *item)
+{
+#if LINKED_LIST_POOL_SIZE > 0
+    return (uintptr_t) item >= (uintptr_t) nodePool
+            && (uintptr_t) item < (uintptr_t) &nodePool[LINKED_LIST_POOL_SIZE];
+#else
+    (void) item;
+    return FALSE;
+#endif
+}
+
+#if LINKED_LIST_POOL_SIZE > 0
+/**
+ * LinkedListPoolTake() takes one ListItem out of the node pool, or returns NULL if it is empty.
+ */
+static ListItem *LinkedListPoolTake(void)
+{
+    ListItem *item = NULL;
+    if (freeItems != NULL) {
+        item = freeItems;
+        freeItems = item->nextItem;
+    } else if (poolUnused < LINKED_LIST_POOL_SIZE) {
+        item = &nodePool[poolUnused++];
+    }
+    return item;
+}
+#endif
+
+/**
+ * LinkedListAllocItem() hands out the memory for one ListItem, from the node pool or from malloc()
+ * depending on LINKED_LIST_POOL_SIZE, or from malloc() until the heap headroom reaches
+ * LINKED_LIST_HEAP_RESERVE and from the pool after that if both are set. Every path is O(1) and
+ * updates poolStats.
+ */
+static ListItem *LinkedListAllocItem(void)
+{
+    ListItem *item = NULL;
+#if LINKED_LIST_POOL_SIZE > 0 && LINKED_LIST_HEAP_RESERVE > 0
+    if (LINKED_LIST_HEAP_SIZE - poolStats.heapBytes - (int) (sizeof (ListItem)
+            + LINKED_LIST_HEAP_OVERHEAD) >= LINKED_LIST_HEAP_RESERVE) {
+        item = LinkedListHeapAlloc(sizeof (ListItem));
+    }
+    if (item == NULL) {
+        item = LinkedListPoolTake();
+        if (item != NULL) {
+            poolStats.fallbacks++;
+        }
+    }
+#elif LINKED_LIST_POOL_SIZE > 0
+    item = LinkedListPoolTake();
+#else
+    item = LinkedListHeapAlloc(sizeof (ListItem));
+#endif
+    if (item == NULL) {
+        poolStats.exhausted++;
+        return NULL;
+    }
+    if (++poolStats.inUse > poolStats.highWater) {
+        poolStats.highWater = poolStats.inUse;
+    }
+    STATS_ADD(allocations, 1);
+    STATS_LIVE(1);
+    return item;
+}
+
+/**
+ * LinkedListFreeItem() gives the memory of a ListItem back to wherever LinkedListAllocItem() got it
+ * from. The item must already be unlinked from its list.
+ */
+static void LinkedListFreeItem(ListItem *item)
+{
+    poolStats.inUse--;
+    STATS_LIVE(-1);
+#ifdef LINKED_LIST_INTERN
+    LinkedListUncount(item);
+#endif
+    // Items of a block are only given back all together by LinkedListFreeArray().
+    if (item->flags & LIST_ITEM_BLOCK) {
+        item->flags |= LIST_ITEM_RELEASED;
+        return;
+    }
+    STATS_ADD(frees, 1);
+#if LINKED_LIST_POOL_SIZE > 0
+    if (LinkedListInPool(item)) {
+        item->nextItem = freeItems;
+        freeItems = item;
+        return;
+    }
+#endif
+    LinkedListHeapFree(item, sizeof (ListItem));
+}
 
 /**
  * This is the struct that will hold an individual list item. This is a doubly-linked list and
@@ -45,15 +262,232 @@
  */
 ListItem *LinkedListNew(char *data)
 {
-
-    ListItem *temp = malloc(sizeof (ListItem));
-    temp->data = data;
+    ListItem *temp = LinkedListAllocItem();
     if (temp == NULL) {
         return NULL;
     }
+    temp->previousItem = NULL;
+    temp->nextItem = NULL;
+    temp->owner = NULL;
+    temp->flags = 0;
+    temp->wordId = 0;
+    LinkedListSetData(temp, data);
     return temp;
 }
 
+/**
+ * LinkedListSortKey() packs the parts of data that decide most comparisons into one word: the
+ * length plus one in the top byte (0 for NULL) followed by the first three characters, big-endian
+ * and zero padded. Strings longer than SORT_KEY_MAX_LENGTH all get the same key, 0xFF000000.
+ * Comparing two keys as unsigned numbers gives the same order as LinkedListCompare() whenever the
+ * keys differ.
+ */
+static uint32_t LinkedListSortKey(const char *data, unsigned int length)
+{
+    if (data == NULL) {
+        return 0;
+    }
+    if (length > SORT_KEY_MAX_LENGTH) {
+        return 0xFF000000u;
+    }
+    uint32_t key = (uint32_t) (length + 1) << 24;
+    int shift;
+    for (shift = 16; shift >= 0 && *data != '\0'; shift -= 8, data++) {
+        key |= (uint32_t) (unsigned char) *data << shift;
+    }
+    return key;
+}
+
+/**
+ * LinkedListSetData() stores data in item and refreshes the cached length that LinkedListSort()
+ * and the word counting code rely on. Always go through this function (or LinkedListSwapData())
+ * instead of assigning item->data directly, otherwise the cached length goes stale.
+ *
+ * If LINKED_LIST_INTERN is defined, data is also interned: the first pointer seen for every
+ * distinct string becomes its canonical pointer and is stored instead of any later pointer to an
+ * equal string, along with a small id in wordId. Equal words then share one pointer and one id, so
+ * telling them apart never needs strcmp(). This means the data pointer stored (and eventually
+ * returned by LinkedListRemove()) may not be the one that was passed in, and that interned strings
+ * must stay valid until LinkedListInternReset(). Once the intern table is full new strings are
+ * stored as they are, with a wordId of 0.
+ *
+ * @param item The ListItem to update.
+ * @param data The new data pointer. May be NULL.
+ * @return SUCCESS or STANDARD_ERROR if item is NULL.
+ */
+int LinkedListSetData(ListItem *item, char *data)
+{
+    if (item == NULL) {
+        return STANDARD_ERROR;
+    }
+    unsigned int length = (data == NULL) ? 0 : FastStringLength(data);
+    return LinkedListSetKnownData(item, data, length, LinkedListSortKey(data, length));
+}
+
+/**
+ * LinkedListSetKnownData() is LinkedListSetData() for data whose length and sort key are already
+ * known, such as the words of a generated table, so that storing it does not read the string.
+ * sortKey must be packed the way LinkedListSetData() packs it: the length plus one in the top byte
+ * followed by the first three characters, big-endian and zero padded, or 0xFF000000 for strings
+ * longer than 253 characters. gen_dictionary.py generates such keys. Interning still hashes data
+ * when LINKED_LIST_INTERN is defined.
+ *
+ * @param item The ListItem to update.
+ * @param data The new data pointer. May be NULL, in which case length and sortKey are ignored.
+ * @param length The length of data, as returned by strlen().
+ * @param sortKey The sort key of data.
+ * @return SUCCESS or STANDARD_ERROR if item is NULL.
+ */
+int LinkedListSetKnownData(ListItem *item, char *data, unsigned int length, uint32_t sortKey)
+{
+    if (item == NULL) {
+        return STANDARD_ERROR;
+    }
+    if (item->owner != NULL) {
+        item->owner->sorted = FALSE;
+    }
+#ifdef LINKED_LIST_INTERN
+    LinkedListUncount(item);
+#endif
+    item->data = data;
+    item->length = (data == NULL) ? 0 : length;
+    item->sortKey = (data == NULL) ? 0 : sortKey;
+    item->wordId = 0;
+#ifdef LINKED_LIST_INTERN
+    if (data != NULL) {
+        if (!internTableReady) {
+            LinkedListInternReset();
+        }
+        WordTableEntry *entry = WordTableLookup(&internTable, data, item->length, TRUE);
+        if (entry != NULL) {
+            item->data = (char *) entry->word;
+            item->wordId = entry->id;
+            internEntries[entry->id] = entry;
+            // An item that is not last may now come before the known first occurrence.
+            if (entry->count++ == 0) {
+                entry->firstItem = item;
+            } else if (item->nextItem != NULL) {
+                entry->firstItem = NULL;
+            }
+        }
+    }
+#endif
+    return SUCCESS;
+}
+
+/**
+ * LinkedListInitProbe() fills in a ListItem that is not part of any list, so that it can be passed
+ * to LinkedListCompare() and LinkedListEqual() to compare list items against a plain string, for
+ * example one on the stack. Unlike LinkedListSetData() it never adds data to the intern table; if
+ * LINKED_LIST_INTERN is defined and data is already interned, the probe gets its wordId.
+ *
+ * @param probe The ListItem to fill in. Its links and owner are cleared.
+ * @param data The string to compare against. May be NULL.
+ */
+void LinkedListInitProbe(ListItem *probe, char *data)
+{
+    probe->previousItem = NULL;
+    probe->nextItem = NULL;
+    probe->owner = NULL;
+    probe->flags = 0;
+    probe->data = data;
+    probe->length = (data == NULL) ? 0 : FastStringLength(data);
+    probe->sortKey = LinkedListSortKey(data, probe->length);
+    probe->wordId = 0;
+#ifdef LINKED_LIST_INTERN
+    if (data != NULL && internTableReady) {
+        WordTableEntry *entry = WordTableLookup(&internTable, data, probe->length, FALSE);
+        if (entry != NULL) {
+            probe->data = (char *) entry->word;
+            probe->wordId = entry->id;
+        }
+    }
+#endif
+}
+
+#ifdef LINKED_LIST_INTERN
+/**
+ * LinkedListInternReset() forgets every interned string, so that their memory can be reused. Only
+ * call it when no ListItem holding interned data is left, otherwise old and new ids get mixed up.
+ */
+void LinkedListInternReset(void)
+{
+    WordTableClear(&internTable);
+    internTableReady = TRUE;
+}
+#endif
+
+/**
+ * LinkedListFromArray() builds a list holding the n strings of words, in that order, with a single
+ * malloc() for all of its ListItems. The items sit next to each other in memory, which is cheaper
+ * than n calls to LinkedListCreateAfter() and faster to walk. The items can be used like any other
+ * ListItem, including LinkedListRemove(), but their memory is only given back when the whole block
+ * is released with LinkedListFreeArray(). The block always comes from the heap, even if
+ * LINKED_LIST_POOL_SIZE is set.
+ *
+ * @param words The data for the new ListItems. Entries may be NULL.
+ * @param n The number of entries in words.
+ * @return The first ListItem of the block, which is also the head of the new list, or NULL if n is
+ *         not positive or malloc() failed. Keep this pointer for LinkedListFreeArray(): once the
+ *         list is sorted it is not necessarily the head anymore.
+ */
+ListItem *LinkedListFromArray(char **words, int n)
+{
+    if (words == NULL || n <= 0) {
+        return NULL;
+    }
+    ListItem *block = LinkedListHeapAlloc(n * sizeof (ListItem));
+    if (block == NULL) {
+        poolStats.exhausted++;
+        return NULL;
+    }
+    int i;
+    for (i = 0; i < n; i++) {
+        // Link forward only after setting the data, the items are still the last ones then.
+        block[i].previousItem = (i > 0) ? &block[i - 1] : NULL;
+        block[i].nextItem = NULL;
+        block[i].owner = NULL;
+        block[i].flags = LIST_ITEM_BLOCK;
+        block[i].wordId = 0;
+        LinkedListSetData(&block[i], words[i]);
+        if (i > 0) {
+            block[i - 1].nextItem = &block[i];
+        }
+    }
+    poolStats.inUse += n;
+    if (poolStats.inUse > poolStats.highWater) {
+        poolStats.highWater = poolStats.inUse;
+    }
+    STATS_ADD(allocations, 1);
+    STATS_LIVE(n);
+    return block;
+}
+
+/**
+ * LinkedListFreeArray() releases a block created by LinkedListFromArray() with a single free().
+ * Items of the block that are still part of a list are removed from it first, so the block may have
+ * been sorted or mixed with other ListItems. The data pointers are not freed.
+ *
+ * @param block The pointer returned by LinkedListFromArray().
+ * @param n The number of ListItems in the block, as passed to LinkedListFromArray().
+ * @return SUCCESS or STANDARD_ERROR if block is NULL or n is not positive.
+ */
+int LinkedListFreeArray(ListItem *block, int n)
+{
+    if (block == NULL || n <= 0) {
+        return STANDARD_ERROR;
+    }
+    int i;
+    for (i = 0; i < n; i++) {
+        if (!(block[i].flags & LIST_ITEM_RELEASED)) {
+            LinkedListRemove(&block[i]);
+        }
+    }
+    LinkedListHeapFree(block, n * sizeof (ListItem));
+    STATS_ADD(frees, 1);
+    return SUCCESS;
+}
+
 /**
  * This function will remove a list item from the linked list and free() the memory that the
  * ListItem struct was using. It doesn't, however, free() the data pointer and instead returns it
@@ -66,64 +500,174 @@ ListItem *LinkedListNew(char *data)
 char *LinkedListRemove(ListItem *item)
 {
     ListItem *temp = item;
-    char *data = temp->data;
     if (temp == NULL) {
         return NULL;
     }
+    char *data = temp->data;
+    if (temp->owner != NULL) {
+        temp->owner->size--;
+        if (temp->owner->head == temp) {
+            temp->owner->head = temp->nextItem;
+        }
+        if (temp->owner->tail == temp) {
+            temp->owner->tail = temp->previousItem;
+        }
+    }
     if (temp->nextItem == NULL && temp->previousItem == NULL) {
-        free(temp);
+        LinkedListFreeItem(temp);
     } else if (temp->nextItem == NULL) {
         temp->previousItem->nextItem = NULL;
-        free(temp);
+        LinkedListFreeItem(temp);
     } else if (temp->previousItem == NULL) {
         temp->nextItem->previousItem = NULL;
-        free(temp);
+        LinkedListFreeItem(temp);
     } else {
         temp->nextItem->previousItem = temp->previousItem;
         temp->previousItem->nextItem = temp->nextItem;
-        free(temp);
+        LinkedListFreeItem(temp);
     }
     return data;
 
 }
 
+/**
+ * LinkedListFreeRange() removes the ListItems from first up to and including last from their list
+ * and frees them in a single pass. Only the neighbours just outside the range are relinked, and a
+ * LinkedList header tracking the list is updated once. If freeData is not NULL it is called with
+ * every non-NULL data pointer in the range before its ListItem is freed. Works the same whether the
+ * ListItems come from the heap, the node pool or a LinkedListFromArray() block. With
+ * LINKED_LIST_INTERN equal strings share one pointer, so freeData should be NULL in that case.
+ *
+ * @param first The first ListItem to free.
+ * @param last The last ListItem to free. Must be first or come after it in the same list. If NULL,
+ *             everything from first to the end of the list is freed.
+ * @param freeData Called on every data pointer that is freed. May be NULL.
+ * @return SUCCESS or STANDARD_ERROR if first is NULL.
+ */
+int LinkedListFreeRange(ListItem *first, ListItem *last, LinkedListFreeDataFunction freeData)
+{
+    if (first == NULL) {
+        return STANDARD_ERROR;
+    }
+    LinkedList *owner = first->owner;
+    ListItem *before = first->previousItem;
+    ListItem *after = (last == NULL) ? NULL : last->nextItem;
+    ListItem *item, *next;
+
+    // Close the gap first, none of the links inside the range matter anymore.
+    if (before != NULL) {
+        before->nextItem = after;
+    }
+    if (after != NULL) {
+        after->previousItem = before;
+    }
+    for (item = first; item != after; item = next) {
+        next = item->nextItem;
+        if (freeData != NULL && item->data != NULL) {
+            freeData(item->data);
+        }
+        if (owner != NULL) {
+            owner->size--;
+        }
+        LinkedListFreeItem(item);
+    }
+    if (owner != NULL) {
+        if (before == NULL) {
+            owner->head = after;
+        }
+        if (after == NULL) {
+            owner->tail = before;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * LinkedListFreeAll() frees every ListItem of the list that any belongs to in a single pass, see
+ * LinkedListFreeRange().
+ *
+ * @param any Any element in the list to free.
+ * @param freeData Called on every data pointer that is freed. May be NULL.
+ * @return SUCCESS or STANDARD_ERROR if any is NULL.
+ */
+int LinkedListFreeAll(ListItem *any, LinkedListFreeDataFunction freeData)
+{
+    return LinkedListFreeRange(LinkedListGetFirst(any), NULL, freeData);
+}
+
 /**
  * This function returns the total size of the linked list. This means that even if it is passed a
  * ListItem that is not at the head of the list, it should still return the total number of
- * ListItems in the list. A NULL argument will result in 0 being returned.
+ * ListItems in the list. A NULL argument will result in 0 being returned. If the list is tracked by
+ * a LinkedList header this is O(1), otherwise the whole list is walked.
  *
  * @param list An item in the list to be sized.
  * @return The number of ListItems in the list (0 if `list` was NULL).
  */
 int LinkedListSize(ListItem *list)
 {
+    if (list != NULL && list->owner != NULL) {
+        return LinkedListCount(list->owner);
+    }
     ListItem *temp = LinkedListGetFirst(list);
     int count = 0;
     while (temp != NULL) {
         count++;
         temp = temp->nextItem;
     }
+    STATS_ADD(sizeVisits, count);
     return count;
 }
 
 /**
  * This function returns the head of a list given some element in the list. If it is passed NULL,
  * it will just return NULL. If given the head of the list it will just return the pointer to the
- * head anyways for consistency.
+ * head anyways for consistency. If the list is tracked by a LinkedList header this is O(1).
  *
  * @param list An element in a list.
  * @return The first element in the list. Or NULL if provided an invalid list.
  */
 ListItem *LinkedListGetFirst(ListItem *list)
 {
+    if (list == NULL) {
+        return NULL;
+    }
+    if (list->owner != NULL) {
+        return LinkedListHead(list->owner);
+    }
     ListItem *first;
     first = list;
     while (first->previousItem != NULL) {
         first = first->previousItem;
+        STATS_ADD(firstVisits, 1);
     }
     return first;
 }
 
+/**
+ * LinkedListGetLast() is the counterpart to LinkedListGetFirst(): it returns the tail of the list
+ * that list is part of, or NULL if passed NULL. If the list is tracked by a LinkedList header this
+ * is O(1).
+ *
+ * @param list An element in a list.
+ * @return The last element in the list. Or NULL if provided an invalid list.
+ */
+ListItem *LinkedListGetLast(ListItem *list)
+{
+    if (list == NULL) {
+        return NULL;
+    }
+    if (list->owner != NULL) {
+        return LinkedListTail(list->owner);
+    }
+    ListItem *last;
+    last = list;
+    while (last->nextItem != NULL) {
+        last = last->nextItem;
+    }
+    return last;
+}
+
 /**
  * This function allocates a new ListItem containing data and inserts it into the list directly
  * after item. It rearranges the pointers of other elements in the list to make this happen. If
@@ -141,6 +685,17 @@ ListItem *LinkedListCreateAfter(ListItem *item, char *data)
     if (new == NULL) {
         return NULL;
     }
+    if (item == NULL) {
+        return new;
+    }
+    if (item->owner != NULL) {
+        new->owner = item->owner;
+        new->owner->size++;
+        new->owner->sorted = FALSE;
+        if (new->owner->tail == item) {
+            new->owner->tail = new;
+        }
+    }
     if (item->nextItem == NULL) {
         new->nextItem = NULL;
         new->previousItem = item;
@@ -150,17 +705,159 @@ ListItem *LinkedListCreateAfter(ListItem *item, char *data)
         new->nextItem = item->nextItem;
         item->nextItem->previousItem = new;
         item->nextItem = new;
+#ifdef LINKED_LIST_INTERN
+        LinkedListForgetFirst(new);
+#endif
     }
     return new;
 }
 
+/**
+ * LinkedListSplice() moves the run of ListItems from first up to and including last out of its
+ * list and links it in right after dst, by relinking the ends of the run only. Nothing is allocated
+ * or copied. dst may be in the same list as the run, as long as it is not part of it. This is O(1)
+ * when the run stays under the same LinkedList header (or neither list has one). Moving it between
+ * headers takes one walk over the run to update the items' owner and both sizes, and so does
+ * LINKED_LIST_INTERN, which has to forget the first occurrences of the moved words.
+ *
+ * @param dst The ListItem to insert the run after.
+ * @param first The first ListItem of the run.
+ * @param last The last ListItem of the run. Must be first or come after it in the same list.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers or dst is one of the ends of the run.
+ */
+int LinkedListSplice(ListItem *dst, ListItem *first, ListItem *last)
+{
+    if (dst == NULL || first == NULL || last == NULL || dst == first || dst == last) {
+        return STANDARD_ERROR;
+    }
+    LinkedList *from = first->owner;
+    LinkedList *to = dst->owner;
+    ListItem *before = first->previousItem;
+    ListItem *after = last->nextItem;
+
+    // Close the gap the run leaves behind.
+    if (before != NULL) {
+        before->nextItem = after;
+    }
+    if (after != NULL) {
+        after->previousItem = before;
+    }
+    if (from != NULL) {
+        if (from->head == first) {
+            from->head = after;
+        }
+        if (from->tail == last) {
+            from->tail = before;
+        }
+    }
+
+    // Only the ends of the run are relinked, the links inside it stay as they are.
+    first->previousItem = dst;
+    last->nextItem = dst->nextItem;
+    if (dst->nextItem != NULL) {
+        dst->nextItem->previousItem = last;
+    }
+    dst->nextItem = first;
+    if (to != NULL) {
+        if (to->tail == dst) {
+            to->tail = last;
+        }
+        to->sorted = FALSE;
+    }
+
+#ifndef LINKED_LIST_INTERN
+    if (from == to) {
+        return SUCCESS;
+    }
+#endif
+    ListItem *item;
+    int count = 0;
+    for (item = first; item != last->nextItem; item = item->nextItem) {
+        item->owner = to;
+#ifdef LINKED_LIST_INTERN
+        LinkedListForgetFirst(item);
+#endif
+        count++;
+    }
+    if (from != to) {
+        if (from != NULL) {
+            from->size -= count;
+        }
+        if (to != NULL) {
+            to->size += count;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * LinkedListSplit() cuts the list in two right before at. The items before at stay where they are,
+ * including under their LinkedList header, and at becomes the head of a new list of its own that no
+ * header tracks. This is O(1) for a list without a header, and takes one walk over the new list to
+ * clear the items' owner otherwise.
+ *
+ * @param at The first ListItem of the new list.
+ * @return at, now the head of the new list, or NULL if at is NULL.
+ */
+ListItem *LinkedListSplit(ListItem *at)
+{
+    if (at == NULL) {
+        return NULL;
+    }
+    LinkedList *owner = at->owner;
+    ListItem *before = at->previousItem;
+    if (before != NULL) {
+        before->nextItem = NULL;
+        at->previousItem = NULL;
+    }
+    if (owner != NULL) {
+        ListItem *item;
+        for (item = at; item != NULL; item = item->nextItem) {
+            item->owner = NULL;
+            owner->size--;
+        }
+        owner->tail = before;
+        if (before == NULL) {
+            owner->head = NULL;
+        }
+    }
+    return at;
+}
+
+/**
+ * LinkedListConcat() moves the whole list that b belongs to onto the end of the list that a belongs
+ * to, see LinkedListSplice(). The tail of a's list and the ends of b's list are found through their
+ * LinkedList headers, or by walking if there are none, so this is O(1) when both lists have headers
+ * (plus the walk LinkedListSplice() needs between two headers) or when a is the tail and b the head
+ * of a list without a header. Afterwards b's header, if any, is empty.
+ *
+ * @param a Any element of the list to append to.
+ * @param b Any element of the list to append.
+ * @return The head of the combined list, or NULL if passed NULL pointers or both are in one list.
+ */
+ListItem *LinkedListConcat(ListItem *a, ListItem *b)
+{
+    if (a == NULL || b == NULL) {
+        return NULL;
+    }
+    ListItem *tail = LinkedListGetLast(a);
+    ListItem *first = LinkedListGetFirst(b);
+    ListItem *last = LinkedListGetLast(b);
+    if (tail == last) {
+        return NULL;
+    }
+    LinkedListSplice(tail, first, last);
+    return LinkedListGetFirst(a);
+}
+
 /**
  * LinkedListSwapData() switches the data pointers of the two provided ListItems. This is most
  * useful when trying to reorder ListItems but when you want to preserve their location. It is used
  * within LinkedListSort() for swapping items, but probably isn't too useful otherwise. This
  * function should return STANDARD_ERROR if either arguments are NULL, otherwise it should return
  * SUCCESS. If one or both of the data pointers are NULL in the given ListItems, it still does
- * perform the swap and returns SUCCESS.
+ * perform the swap and returns SUCCESS. The LinkedList headers of both items, if any, are no longer
+ * marked as sorted afterwards.
  *
  * @param firstItem One of the items whose data will be swapped.
  * @param secondItem Another item whose data will be swapped.
@@ -168,11 +865,34 @@ ListItem *LinkedListCreateAfter(ListItem *item, char *data)
  */
 int LinkedListSwapData(ListItem *firstItem, ListItem *secondItem)
 {
-    if (firstItem != NULL || secondItem != NULL) {
+    if (firstItem != NULL && secondItem != NULL) {
+#ifdef LINKED_LIST_INTERN
+        LinkedListForgetFirst(firstItem);
+        LinkedListForgetFirst(secondItem);
+#endif
         char *temp = NULL;
+        unsigned int tempLength;
+        unsigned short tempWordId;
+        uint32_t tempSortKey;
         temp = firstItem->data;
+        tempLength = firstItem->length;
+        tempWordId = firstItem->wordId;
+        tempSortKey = firstItem->sortKey;
         firstItem->data = secondItem->data;
+        firstItem->length = secondItem->length;
+        firstItem->wordId = secondItem->wordId;
+        firstItem->sortKey = secondItem->sortKey;
         secondItem->data = temp;
+        secondItem->length = tempLength;
+        secondItem->wordId = tempWordId;
+        secondItem->sortKey = tempSortKey;
+        if (firstItem->owner != NULL) {
+            firstItem->owner->sorted = FALSE;
+        }
+        if (secondItem->owner != NULL) {
+            secondItem->owner->sorted = FALSE;
+        }
+        STATS_ADD(swaps, 1);
         return SUCCESS;
     } else {
         return STANDARD_ERROR;
@@ -180,90 +900,1247 @@ int LinkedListSwapData(ListItem *firstItem, ListItem *secondItem)
 }
 
 /**
- * LinkedListSort() performs a selection sort on list to sort the elements into decending order. It
- * makes no guarantees of the addresses of the list items after sorting, so any ListItem referenced
- * before a call to LinkedListSort() and after may contain different data as only the data pointers
- * for the ListItems in the list are swapped. This function sorts the strings in ascending order
- * first by size (with NULL data pointers counting as 0-length strings) and then alphabetically
- * ascending order. So the list [dog, cat, duck, goat, NULL] will be sorted to [NULL, cat, dog,
- * duck, goat]. LinkedListSort() returns SUCCESS if sorting was possible. If passed a NULL pointer
- * for either argument, it will do nothing and return STANDARD_ERROR.
+ * LinkedListCompare() orders two list items the way LinkedListSort() does: NULL data first, then
+ * by string length, then alphabetically. Most pairs are decided by a single compare of the packed
+ * sort keys cached by LinkedListSetData(); FastStringCompare() only runs, past the first three
+ * characters, on strings of the same length that start the same way.
  *
- * @param list Any element in the list to sort.
- * @return SUCCESS if successful or STANDARD_ERROR is passed NULL pointers.
+ * @param firstItem The item on the left-hand side of the comparison.
+ * @param secondItem The item on the right-hand side of the comparison.
+ * @return A negative number if firstItem sorts before secondItem, zero if they sort the same and
+ *         a positive number otherwise.
  */
-int LinkedListSort(ListItem *list)
+int LinkedListCompare(const ListItem *firstItem, const ListItem *secondItem)
 {
-    if (list == NULL) {
-        return STANDARD_ERROR;
+    STATS_ADD(comparisons, 1);
+    if (firstItem->sortKey != secondItem->sortKey) {
+        return firstItem->sortKey < secondItem->sortKey ? -1 : 1;
     }
-    ListItem *select,*cmp;
-    for(select = list; select->nextItem !=NULL; select = select->nextItem){
-        for(cmp = select->nextItem; cmp != NULL; cmp = cmp->nextItem){
-            if (select->data == NULL){
-                break;
-            } else if (cmp->data == NULL){
-                LinkedListSwapData(select,cmp);
-            } else if (strlen(select->data)>strlen(cmp->data)){
-                LinkedListSwapData(select,cmp);
-            } else if (strlen(select->data) == strlen(cmp->data)){
-                if(strcmp(cmp->data,select->data)<0){
-                    LinkedListSwapData(select,cmp);
-                }
-            }
+    // Equal keys mean both are NULL, both are too long for the key, or both have the same length
+    // and start with the same three characters.
+    if (firstItem->data == NULL || firstItem->data == secondItem->data) {
+        return 0;
+    }
+    if (firstItem->length > SORT_KEY_MAX_LENGTH) {
+        if (firstItem->length != secondItem->length) {
+            return firstItem->length < secondItem->length ? -1 : 1;
         }
+        return FastStringCompare(firstItem->data, secondItem->data, firstItem->length);
     }
-//    int f1, f2;
-//    ListItem *temp, *current;
-//    current = list;
-//    int size = LinkedListSize(current);
-//    current = LinkedListGetFirst(current);
-//    for (f1 = 0; f1 < size - 1; f1++) {
-//        temp = current;
-//        for (f2 = f1 + 1; f2 < size; f2++) {
-//            if (current->data == NULL) {
-//                LinkedListSwapData(current, temp);
-//            } else if (temp->data == NULL) {
-//                break;
-//            } else if (strlen(current->data) < strlen(temp->data)) {
-//                LinkedListSwapData(current, temp);
-//            } else if (strlen(current->data) == strlen(temp->data)) {
-//                if (strcmp(current->data, temp->data) < 0) {
-//                    LinkedListSwapData(current, temp);
-//                }
-//            }
-//            current = current->nextItem;
-//        }
-//        current = temp;
-//        current = current->nextItem;
-//    }
-    return SUCCESS;
+    if (firstItem->length <= 3) {
+        return 0;
+    }
+    return FastStringCompare(firstItem->data + 3, secondItem->data + 3, firstItem->length - 3);
 }
 
 /**
- * LinkedListPrint() prints out the complete list to stdout. This function prints out the given
- * list, starting at the head if the provided pointer is not the head of the list, like "[STRING1,
- * STRING2, ... ]" If LinkedListPrint() is called with a NULL list it does nothing, returning
- * STANDARD_ERROR. If passed a valid pointer, prints the list and returns SUCCESS.
+ * LinkedListEqual() checks whether two list items hold the same word. Two NULL data pointers are
+ * equal to each other but never to a string. Items with different sort keys or different interned
+ * ids are rejected without looking at the strings at all.
  *
- * @param list Any element in the list to print.
- * @return SUCCESS or STANDARD_ERROR if passed NULL pointers.
+ * @param firstItem One of the items to compare.
+ * @param secondItem The other item to compare.
+ * @return TRUE if both items hold equal data, FALSE otherwise.
  */
-int LinkedListPrint(ListItem *list)
+int LinkedListEqual(const ListItem *firstItem, const ListItem *secondItem)
 {
-    if (list == NULL) {
-        return STANDARD_ERROR;
+    if (firstItem->data == secondItem->data) {
+        return TRUE;
     }
-    list = LinkedListGetFirst(list);
-    printf("{");
-    while (list != NULL) {
-        if (list->data == NULL) {
-            printf("-(null)-");
-        } else {
-            printf("-%s-", list->data);
-        }
-        list = list->nextItem;
+    if (firstItem->data == NULL || secondItem->data == NULL) {
+        return FALSE;
     }
-    printf("}\n");
-    return SUCCESS;
+    if (firstItem->wordId != 0 && secondItem->wordId != 0) {
+        return firstItem->wordId == secondItem->wordId;
+    }
+    return LinkedListCompare(firstItem, secondItem) == 0;
+}
+
+/**
+ * LinkedListWordCount() returns the word count of item in the encoding UnsortedWordCount() in
+ * sort.c uses: the number of ListItems holding the same word if item is the first of them in its
+ * list, the negative of that number if it is a later one, and 0 for NULL data.
+ *
+ * With LINKED_LIST_INTERN defined this is an online count: every intern table entry tracks how
+ * many live ListItems hold its word, updated in O(1) whenever an item is created, changed or freed,
+ * and remembers which of them comes first. An insert in the middle of the list, a data change or a
+ * swap only marks the first occurrence of the affected word as unknown, and only then is it looked
+ * up again, once. Sorting finds all of them again in one pass. So filling in a whole wordCount array
+ * costs O(n) plus a walk for each word changed since the last call, instead of O(n^2). The counts
+ * cover every live ListItem, so meaningful results need the counted list to be the only one holding
+ * these words. Without LINKED_LIST_INTERN, or for words that did not fit into the intern table,
+ * item's list is walked instead.
+ *
+ * @param item The ListItem to count.
+ * @return The signed count, or 0 if item is NULL or holds NULL.
+ */
+int LinkedListWordCount(const ListItem *item)
+{
+    if (item == NULL || item->data == NULL) {
+        return 0;
+    }
+    const ListItem *other;
+#ifdef LINKED_LIST_INTERN
+    if (item->wordId != 0) {
+        WordTableEntry *entry = internEntries[item->wordId];
+        if (entry->firstItem == NULL) {
+            for (other = item; other->previousItem != NULL; other = other->previousItem);
+            while (other->wordId != item->wordId) {
+                other = other->nextItem;
+            }
+            entry->firstItem = other;
+        }
+        return (entry->firstItem == item) ? entry->count : -entry->count;
+    }
+#endif
+    int count = 1;
+    int first = TRUE;
+    for (other = item->previousItem; other != NULL; other = other->previousItem) {
+        if (LinkedListEqual(other, item)) {
+            count++;
+            first = FALSE;
+        }
+    }
+    for (other = item->nextItem; other != NULL; other = other->nextItem) {
+        if (LinkedListEqual(other, item)) {
+            count++;
+        }
+    }
+    return first ? count : -count;
+}
+
+/**
+ * LinkedListMergeChain() sorts the chain of ListItems starting at head with a bottom-up merge sort.
+ * Only the nextItem links are used and updated, the chain must end in NULL. Returns the new head of
+ * the chain.
+ *
+ * Runs of width 1, 2, 4, ... are merged pairwise along the links until one run is left, so there
+ * is no recursion and nothing is allocated. When the heads of both runs compare equal the merge
+ * takes the left one, which is what makes the sort stable. LinkedListSortStep(), ArrayListSort()
+ * and ListNodeSort() in IntrusiveList.c are this same loop over other kinds of links.
+ */
+static ListItem *LinkedListMergeChain(ListItem *head)
+{
+    ListItem *left, *right, *tail, *next;
+    int width, merges, leftSize, rightSize;
+
+    // Merge runs of width 1, 2, 4, ... until one run is left.
+    for (width = 1; head != NULL; width *= 2) {
+        left = head;
+        head = NULL;
+        tail = NULL;
+        merges = 0;
+        while (left != NULL) {
+            merges++;
+            right = left;
+            for (leftSize = 0; leftSize < width && right != NULL; leftSize++) {
+                right = right->nextItem;
+            }
+            rightSize = width;
+            while (leftSize > 0 || (rightSize > 0 && right != NULL)) {
+                // Ties go to the left run.
+                if (leftSize == 0) {
+                    next = right;
+                    right = right->nextItem;
+                    rightSize--;
+                } else if (rightSize == 0 || right == NULL || LinkedListCompare(left, right) <= 0) {
+                    next = left;
+                    left = left->nextItem;
+                    leftSize--;
+                } else {
+                    next = right;
+                    right = right->nextItem;
+                    rightSize--;
+                    STATS_ADD(swaps, 1);
+                }
+                if (tail == NULL) {
+                    head = next;
+                } else {
+                    tail->nextItem = next;
+                }
+                tail = next;
+            }
+            left = right;
+        }
+        tail->nextItem = NULL;
+        if (merges <= 1) {
+            break;
+        }
+    }
+    return head;
+}
+
+/**
+ * LinkedListRelink() rebuilds the previousItem links of the chain starting at head from its
+ * nextItem links, and points the owning header, if any, at the new head and tail and marks it as
+ * sorted.
+ */
+static void LinkedListRelink(ListItem *head)
+{
+    ListItem *tail;
+    head->previousItem = NULL;
+    for (tail = head; tail->nextItem != NULL; tail = tail->nextItem) {
+        tail->nextItem->previousItem = tail;
+    }
+#ifdef LINKED_LIST_INTERN
+    // Sorting moved the first occurrences, find them all again while the chain is hot.
+    ListItem *item;
+    for (item = head; item != NULL; item = item->nextItem) {
+        LinkedListForgetFirst(item);
+    }
+    for (item = head; item != NULL; item = item->nextItem) {
+        if (item->wordId != 0 && internEntries[item->wordId]->firstItem == NULL) {
+            internEntries[item->wordId]->firstItem = item;
+        }
+    }
+#endif
+    if (head->owner != NULL) {
+        head->owner->head = head;
+        head->owner->tail = tail;
+        head->owner->sorted = TRUE;
+    }
+}
+
+/**
+ * LinkedListSort() performs a bottom-up merge sort on list to sort the elements into ascending
+ * order. Instead of swapping data pointers it relinks the nextItem and previousItem pointers, so
+ * every ListItem keeps its data but may end up at a different position in the list. In particular
+ * the item passed in is not necessarily the head afterwards, so use LinkedListGetFirst() to find
+ * the new head. This function sorts the strings in ascending order first by size (with NULL data
+ * pointers sorting before every string) and then alphabetically ascending order. So the list [dog,
+ * cat, duck, goat, NULL] will be sorted to [NULL, cat, dog, duck, goat]. The sort is stable: items
+ * that compare equal keep their original relative order. It runs in O(n log n) time and uses no
+ * extra memory. A list tracked by a LinkedList header remembers that it is sorted until it is next
+ * changed, and sorting it again before then returns straight away. LinkedListSort() returns
+ * SUCCESS if sorting was possible. If passed a NULL pointer for either argument, it will do nothing
+ * and return STANDARD_ERROR.
+ *
+ * @param list Any element in the list to sort.
+ * @return SUCCESS if successful or STANDARD_ERROR is passed NULL pointers.
+ */
+int LinkedListSort(ListItem *list)
+{
+    if (list == NULL) {
+        return STANDARD_ERROR;
+    }
+    if (list->owner != NULL && list->owner->sorted) {
+        return SUCCESS;
+    }
+    LinkedListRelink(LinkedListMergeChain(LinkedListGetFirst(list)));
+    return SUCCESS;
+}
+
+/**
+ * LinkedListSortRadix() sorts list into exactly the same order as LinkedListSort(), but makes use
+ * of the ordering being by length first. One pass splices every ListItem onto the end of a bucket
+ * for its length (one for NULL, one per length up to LINKED_LIST_RADIX_MAX_LENGTH and one for
+ * everything longer), so only words of the same length ever get compared to each other. Each
+ * bucket is then merge sorted on its own and the buckets are joined back together in order. Only
+ * pointers are relinked, nothing is allocated. For lists of short words this does much less work
+ * than LinkedListSort(). As with LinkedListSort(), use LinkedListGetFirst() to find the new head.
+ *
+ * @param list Any element in the list to sort.
+ * @return SUCCESS if successful or STANDARD_ERROR is passed NULL pointers.
+ */
+int LinkedListSortRadix(ListItem *list)
+{
+    if (list == NULL) {
+        return STANDARD_ERROR;
+    }
+    if (list->owner != NULL && list->owner->sorted) {
+        return SUCCESS;
+    }
+    ListItem *heads[LINKED_LIST_RADIX_MAX_LENGTH + 3] = {NULL};
+    ListItem *tails[LINKED_LIST_RADIX_MAX_LENGTH + 3];
+    ListItem *item, *next, *head, *tail;
+    unsigned int bucket;
+
+    // Bucket 0 is for NULL, bucket n + 1 for length n and the last one for anything longer.
+    for (item = LinkedListGetFirst(list); item != NULL; item = next) {
+        next = item->nextItem;
+        if (item->data == NULL) {
+            bucket = 0;
+        } else if (item->length <= LINKED_LIST_RADIX_MAX_LENGTH) {
+            bucket = item->length + 1;
+        } else {
+            bucket = LINKED_LIST_RADIX_MAX_LENGTH + 2;
+        }
+        item->nextItem = NULL;
+        if (heads[bucket] == NULL) {
+            heads[bucket] = item;
+        } else {
+            tails[bucket]->nextItem = item;
+        }
+        tails[bucket] = item;
+    }
+
+    head = NULL;
+    tail = NULL;
+    for (bucket = 0; bucket < LINKED_LIST_RADIX_MAX_LENGTH + 3; bucket++) {
+        if (heads[bucket] == NULL) {
+            continue;
+        }
+        // A bucket with a single item, or of NULLs, is already in order.
+        if (heads[bucket] != tails[bucket] && bucket != 0) {
+            heads[bucket] = LinkedListMergeChain(heads[bucket]);
+            for (tails[bucket] = heads[bucket]; tails[bucket]->nextItem != NULL;) {
+                tails[bucket] = tails[bucket]->nextItem;
+            }
+        }
+        if (tail == NULL) {
+            head = heads[bucket];
+        } else {
+            tail->nextItem = heads[bucket];
+        }
+        tail = tails[bucket];
+    }
+    LinkedListRelink(head);
+    return SUCCESS;
+}
+
+/**
+ * LinkedListHeapBefore() orders the lists with indices a and b in the heap of
+ * LinkedListMergeSorted() by their current heads, breaking ties by index to keep the merge stable.
+ */
+static int LinkedListHeapBefore(ListItem **heads, int a, int b)
+{
+    int order = LinkedListCompare(heads[a], heads[b]);
+    return (order != 0) ? order < 0 : a < b;
+}
+
+/**
+ * LinkedListHeapUp() moves the heap entry at position up to its place.
+ */
+static void LinkedListHeapUp(unsigned char *heap, int position, ListItem **heads)
+{
+    unsigned char entry = heap[position];
+    while (position > 0 && LinkedListHeapBefore(heads, entry, heap[(position - 1) / 2])) {
+        heap[position] = heap[(position - 1) / 2];
+        position = (position - 1) / 2;
+    }
+    heap[position] = entry;
+}
+
+/**
+ * LinkedListHeapDown() moves the entry at the top of a heap of n entries down to its place.
+ */
+static void LinkedListHeapDown(unsigned char *heap, int n, ListItem **heads)
+{
+    int position = 0;
+    int child;
+    if (n == 0) {
+        return;
+    }
+    unsigned char entry = heap[0];
+    while ((child = 2 * position + 1) < n) {
+        if (child + 1 < n && LinkedListHeapBefore(heads, heap[child + 1], heap[child])) {
+            child++;
+        }
+        if (!LinkedListHeapBefore(heads, heap[child], entry)) {
+            break;
+        }
+        heap[position] = heap[child];
+        position = child;
+    }
+    heap[position] = entry;
+}
+
+/**
+ * LinkedListMergeSorted() merges k lists that are each sorted with LinkedListSort() into one sorted
+ * list by relinking their ListItems in place, without allocating anything. The heads of the lists
+ * are kept in a binary min-heap on the stack, so every ListItem costs O(log k) comparisons and the
+ * whole merge O(n log k). Equal items keep their order within their list, and items from an earlier
+ * entry of lists come before equal items from a later one, so the result is exactly what sorting
+ * the concatenation of the lists would give. The merged list belongs to the LinkedList header of
+ * the first non-empty list, if it has one, and every other header involved is left empty.
+ *
+ * @param lists Any element of each list to merge. Entries may be NULL for empty lists.
+ * @param k The number of entries in lists, at most LINKED_LIST_MERGE_MAX_LISTS.
+ * @return The head of the merged list, or NULL if every list was empty, lists is NULL or k is out
+ *         of range.
+ */
+ListItem *LinkedListMergeSorted(ListItem **lists, int k)
+{
+    ListItem *heads[LINKED_LIST_MERGE_MAX_LISTS];
+    unsigned char heap[LINKED_LIST_MERGE_MAX_LISTS];
+    LinkedList *owner = NULL;
+    ListItem *head = NULL;
+    ListItem *tail = NULL;
+    ListItem *item;
+    int n = 0;
+    int size = 0;
+    int i;
+
+    if (lists == NULL || k <= 0 || k > LINKED_LIST_MERGE_MAX_LISTS) {
+        return NULL;
+    }
+    for (i = 0; i < k; i++) {
+        heads[i] = LinkedListGetFirst(lists[i]);
+        if (heads[i] == NULL) {
+            continue;
+        }
+        if (n == 0) {
+            owner = heads[i]->owner;
+        } else if (heads[i]->owner != NULL && heads[i]->owner != owner) {
+            LinkedListInit(heads[i]->owner);
+        }
+        heap[n++] = i;
+        LinkedListHeapUp(heap, n - 1, heads);
+    }
+
+    // Take the smallest head, replace it by its successor and restore the heap.
+    while (n > 0) {
+        i = heap[0];
+        item = heads[i];
+        heads[i] = item->nextItem;
+        if (heads[i] == NULL) {
+            heap[0] = heap[--n];
+        }
+        LinkedListHeapDown(heap, n, heads);
+
+        item->owner = owner;
+        if (tail == NULL) {
+            head = item;
+        } else {
+            tail->nextItem = item;
+        }
+        tail = item;
+        size++;
+    }
+    if (head == NULL) {
+        return NULL;
+    }
+    tail->nextItem = NULL;
+    if (owner != NULL) {
+        owner->size = size;
+    }
+    LinkedListRelink(head);
+    return head;
+}
+
+/**
+ * LinkedListUniqueCount() collapses every run of equal words in a sorted list into its first
+ * ListItem in a single pass, and stores how many there were. Each run of duplicates is given back
+ * with one LinkedListFreeRange() call, so to the pool in bulk when LINKED_LIST_POOL_SIZE is set.
+ * As in SortedWordCount() in sort.c, NULL words are not strings: they are never merged and their
+ * count is 0. A list tracked by a LinkedList header that is not sorted is sorted first, any other
+ * list must already be sorted with LinkedListSort(). The list stays sorted.
+ *
+ * @param list Any element in the list.
+ * @param counts Where to store the count of every remaining ListItem, in list order. Needs room for
+ *               as many entries as the list has unique words. May be NULL.
+ * @param freeData Called on the data of every duplicate that is freed. May be NULL, and must be
+ *                 with LINKED_LIST_INTERN, see LinkedListFreeRange().
+ * @return The number of ListItems left, 0 if list is NULL.
+ */
+int LinkedListUniqueCount(ListItem *list, int *counts, LinkedListFreeDataFunction freeData)
+{
+    if (list == NULL) {
+        return 0;
+    }
+    if (list->owner != NULL && !list->owner->sorted) {
+        LinkedListSort(list);
+    }
+    ListItem *item = LinkedListGetFirst(list);
+    ListItem *last;
+    int unique = 0;
+    int count;
+
+    while (item != NULL) {
+        // Find the end of the run of words equal to this one.
+        last = item;
+        count = 1;
+        if (item->data != NULL) {
+            while (last->nextItem != NULL && last->nextItem->data != NULL &&
+                    LinkedListEqual(item, last->nextItem)) {
+                last = last->nextItem;
+                count++;
+            }
+        }
+        if (last != item) {
+            LinkedListFreeRange(item->nextItem, last, freeData);
+        }
+        if (counts != NULL) {
+            counts[unique] = (item->data == NULL) ? 0 : count;
+        }
+        unique++;
+        item = item->nextItem;
+    }
+    return unique;
+}
+
+/**
+ * LinkedListTopRanksLower() checks whether first ranks below second in LinkedListTopK(): it occurs
+ * fewer times, or as often and LinkedListSort() puts it after second.
+ */
+static int LinkedListTopRanksLower(const LinkedListTopWord *first, const LinkedListTopWord *second)
+{
+    if (first->count != second->count) {
+        return first->count < second->count;
+    }
+    return LinkedListCompare(first->item, second->item) > 0;
+}
+
+/**
+ * LinkedListTopUp() moves the entry at position of a LinkedListTopK() heap up to its place.
+ */
+static void LinkedListTopUp(LinkedListTopWord *heap, int position)
+{
+    LinkedListTopWord entry = heap[position];
+    while (position > 0 && LinkedListTopRanksLower(&entry, &heap[(position - 1) / 2])) {
+        heap[position] = heap[(position - 1) / 2];
+        position = (position - 1) / 2;
+    }
+    heap[position] = entry;
+}
+
+/**
+ * LinkedListTopDown() moves the top entry of a LinkedListTopK() heap of n entries down to its
+ * place.
+ */
+static void LinkedListTopDown(LinkedListTopWord *heap, int n)
+{
+    LinkedListTopWord entry = heap[0];
+    int position = 0;
+    int child;
+    while ((child = 2 * position + 1) < n) {
+        if (child + 1 < n && LinkedListTopRanksLower(&heap[child + 1], &heap[child])) {
+            child++;
+        }
+        if (!LinkedListTopRanksLower(&heap[child], &entry)) {
+            break;
+        }
+        heap[position] = heap[child];
+        position = child;
+    }
+    heap[position] = entry;
+}
+
+/**
+ * LinkedListTopOffer() offers the word of item, which occurs count times, to the LinkedListTopK()
+ * heap of *n out of k entries. The heap is a min-heap of the best words so far, so once it is full
+ * a word only gets in by beating the worst one.
+ */
+static void LinkedListTopOffer(LinkedListTopWord *heap, int k, int *n, ListItem *item, int count)
+{
+    LinkedListTopWord candidate;
+    candidate.item = item;
+    candidate.count = count;
+    if (*n < k) {
+        heap[*n] = candidate;
+        LinkedListTopUp(heap, (*n)++);
+    } else if (LinkedListTopRanksLower(&heap[0], &candidate)) {
+        heap[0] = candidate;
+        LinkedListTopDown(heap, k);
+    }
+}
+
+/**
+ * LinkedListTopFinish() turns a LinkedListTopK() heap of n entries into a list, best word first.
+ */
+static void LinkedListTopFinish(LinkedListTopWord *heap, int n)
+{
+    LinkedListTopWord worst;
+    int i;
+    // Move the worst word to the back until the heap is empty, which leaves the best word first.
+    for (i = n - 1; i > 0; i--) {
+        worst = heap[0];
+        heap[0] = heap[i];
+        heap[i] = worst;
+        LinkedListTopDown(heap, i);
+    }
+}
+
+/**
+ * LinkedListTopForget() empties wordTableScratch again after LinkedListTopK() by walking the chain
+ * of its used slots, which starts at slot chain and is linked through first, instead of clearing
+ * every slot.
+ */
+static void LinkedListTopForget(int chain)
+{
+    while (chain >= 0) {
+        wordTableScratch.entries[chain].word = NULL;
+        chain = wordTableScratch.entries[chain].first;
+    }
+    wordTableScratch.used = 0;
+}
+
+/**
+ * LinkedListTopSorted() is LinkedListTopK() for a list with more distinct words than a WordTable
+ * takes: it sorts the list and offers every run of equal words. The sort is stable, so the first
+ * ListItem of a run is still the first one that held its word.
+ */
+static int LinkedListTopSorted(ListItem *list, int k, LinkedListTopWord *out)
+{
+    ListItem *item, *first;
+    int count, n = 0;
+
+    LinkedListSort(list);
+    item = LinkedListGetFirst(list);
+    while (item != NULL) {
+        // Ignore NULL words
+        if (item->data == NULL) {
+            item = item->nextItem;
+            continue;
+        }
+        first = item;
+        for (count = 0; item != NULL && LinkedListEqual(item, first); item = item->nextItem) {
+            count++;
+        }
+        LinkedListTopOffer(out, k, &n, first, count);
+    }
+    LinkedListTopFinish(out, n);
+    return n;
+}
+
+/**
+ * LinkedListTopK() finds the k words that occur most often in a list, without counting into an
+ * array as long as the list. With LINKED_LIST_INTERN defined, the words in the intern table already
+ * have their online counts, see LinkedListWordCount(), which are only read here; as there, the
+ * results are only meaningful if the list is the only one holding these words. Every other word is
+ * counted in the shared wordTableScratch, the same way as UnsortedWordCountHashed() in sort.c does,
+ * and the slots a call used are chained together and emptied one by one afterwards, so no call pays
+ * for the whole WORD_TABLE_CAPACITY. The k most frequent words are kept in a min-heap built in out,
+ * so this takes O(n + d log k) time for d distinct words and O(k) memory. If the list holds more
+ * distinct words than the table can take, the list is sorted with LinkedListSort() instead and its
+ * runs of equal words are counted, in O(n log n); only then is the list changed. Either way the
+ * ListItem stored for a word is the first one holding it, in the order before sorting. Of words
+ * that occur equally often, the one LinkedListSort() puts first ranks higher. NULL words are not
+ * counted.
+ *
+ * @param list Any element in the list.
+ * @param k The most words to find.
+ * @param out Where to store the words, most frequent first. Needs room for k entries.
+ * @return The number of words stored in out, which is less than k if the list has fewer distinct
+ *         words, or 0 if list or out is NULL or k is not positive.
+ */
+int LinkedListTopK(ListItem *list, int k, LinkedListTopWord *out)
+{
+    if (list == NULL || k <= 0 || out == NULL) {
+        return 0;
+    }
+    WordTableEntry *entry;
+    ListItem *item;
+    int i, n = 0, chain = -1, last = -1;
+
+    for (item = LinkedListGetFirst(list); item != NULL; item = item->nextItem) {
+        // Ignore NULL words
+        if (item->data == NULL) {
+            continue;
+        }
+#ifdef LINKED_LIST_INTERN
+        if (item->wordId != 0) {
+            // The walk goes in list order, so an unknown first occurrence is this one.
+            entry = internEntries[item->wordId];
+            if (entry->firstItem == NULL) {
+                entry->firstItem = item;
+            }
+            if (entry->firstItem == item) {
+                LinkedListTopOffer(out, k, &n, item, entry->count);
+            }
+            continue;
+        }
+#endif
+        entry = WordTableLookup(&wordTableScratch, item->data, item->length, TRUE);
+        if (entry == NULL) {
+            LinkedListTopForget(chain);
+            return LinkedListTopSorted(list, k, out);
+        }
+        if (entry->count++ == 0) {
+            // Chain the new slot up in order of first occurrence, which in text tends to put the
+            // most frequent words first and so keeps the heap below from churning.
+            entry->firstItem = item;
+            if (last < 0) {
+                chain = entry - wordTableScratch.entries;
+            } else {
+                wordTableScratch.entries[last].first = entry - wordTableScratch.entries;
+            }
+            last = entry - wordTableScratch.entries;
+        }
+    }
+    for (i = chain; i >= 0; i = entry->first) {
+        entry = &wordTableScratch.entries[i];
+        LinkedListTopOffer(out, k, &n, (ListItem *) entry->firstItem, entry->count);
+    }
+    LinkedListTopForget(chain);
+    LinkedListTopFinish(out, n);
+    return n;
+}
+
+/**
+ * LinkedListSortBegin() starts sorting list into the same order as LinkedListSort(), with the same
+ * stable bottom-up merge sort, but without doing any of the work yet: LinkedListSortStep() does it
+ * a bounded slice at a time, so that a long sort can be spread over several iterations of the main
+ * loop. The list is in pieces until the sort is done, so nothing may look at it or change it in
+ * between, not even through its LinkedList header.
+ *
+ * @param state Where to keep the progress of the sort.
+ * @param list Any element in the list to sort.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers.
+ */
+int LinkedListSortBegin(LinkedListSortState *state, ListItem *list)
+{
+    if (state == NULL || list == NULL) {
+        return STANDARD_ERROR;
+    }
+    state->head = LinkedListGetFirst(list);
+    if (list->owner != NULL && list->owner->sorted) {
+        state->phase = SORT_PHASE_DONE;
+        return SUCCESS;
+    }
+    // The first pass merges runs of one item, collecting the result from head to tail.
+    state->left = state->head;
+    state->head = NULL;
+    state->tail = NULL;
+    state->width = 1;
+    state->merges = 0;
+    state->phase = SORT_PHASE_START;
+    return SUCCESS;
+}
+
+/**
+ * LinkedListSortStep() does up to budget units of sorting work, where a unit is one ListItem
+ * walked over, compared and moved, or relinked. A whole sort of n ListItems takes at most 2n units
+ * for each of the log2(n) (rounded up) merge passes plus 4n + 4 for starting the merges and the
+ * final relink, so O(n log n), and each call costs O(budget).
+ *
+ * @param state The state set up by LinkedListSortBegin().
+ * @param budget The most units to spend.
+ * @return TRUE once the sort is done, FALSE if more steps are needed.
+ */
+int LinkedListSortStep(LinkedListSortState *state, int budget)
+{
+    ListItem *next;
+
+    // This is LinkedListMergeChain() and LinkedListRelink() turned inside out, one unit per turn.
+    for (; budget > 0 && state->phase != SORT_PHASE_DONE; budget--) {
+        switch (state->phase) {
+        case SORT_PHASE_START:
+            if (state->left != NULL) {
+                state->merges++;
+                state->right = state->left;
+                state->leftSize = 0;
+                state->phase = SORT_PHASE_SCAN;
+            } else if (state->merges > 1) {
+                // The pass is over, merge runs twice as wide next.
+                state->tail->nextItem = NULL;
+                state->left = state->head;
+                state->head = NULL;
+                state->tail = NULL;
+                state->merges = 0;
+                state->width *= 2;
+            } else {
+                state->tail->nextItem = NULL;
+                state->head->previousItem = NULL;
+                state->left = state->head;
+                state->phase = SORT_PHASE_RELINK;
+            }
+            break;
+
+        case SORT_PHASE_SCAN:
+            if (state->leftSize < state->width && state->right != NULL) {
+                state->right = state->right->nextItem;
+                state->leftSize++;
+            } else {
+                state->rightSize = state->width;
+                state->phase = SORT_PHASE_MERGE;
+            }
+            break;
+
+        case SORT_PHASE_MERGE:
+            if (state->leftSize == 0 && (state->rightSize == 0 || state->right == NULL)) {
+                state->left = state->right;
+                state->phase = SORT_PHASE_START;
+                break;
+            }
+            // Ties go to the left run, see LinkedListMergeChain().
+            if (state->leftSize == 0) {
+                next = state->right;
+                state->right = next->nextItem;
+                state->rightSize--;
+            } else if (state->rightSize == 0 || state->right == NULL ||
+                    LinkedListCompare(state->left, state->right) <= 0) {
+                next = state->left;
+                state->left = next->nextItem;
+                state->leftSize--;
+            } else {
+                next = state->right;
+                state->right = next->nextItem;
+                state->rightSize--;
+                STATS_ADD(swaps, 1);
+            }
+            if (state->tail == NULL) {
+                state->head = next;
+            } else {
+                state->tail->nextItem = next;
+            }
+            state->tail = next;
+            break;
+
+        case SORT_PHASE_RELINK:
+            next = state->left;
+#ifdef LINKED_LIST_INTERN
+            LinkedListForgetFirst(next);
+#endif
+            if (next->nextItem != NULL) {
+                next->nextItem->previousItem = next;
+                state->left = next->nextItem;
+                break;
+            }
+            if (next->owner != NULL) {
+                next->owner->head = state->head;
+                next->owner->tail = next;
+                next->owner->sorted = TRUE;
+            }
+            state->tail = next;
+            state->phase = SORT_PHASE_DONE;
+            break;
+        }
+    }
+    return state->phase == SORT_PHASE_DONE;
+}
+
+/**
+ * LinkedListSortDone() checks whether the sort described by state is finished. The sorted list
+ * starts at state->head, and its LinkedList header, if any, is marked as sorted.
+ *
+ * @param state The state set up by LinkedListSortBegin().
+ * @return TRUE or FALSE.
+ */
+int LinkedListSortDone(const LinkedListSortState *state)
+{
+    return state->phase == SORT_PHASE_DONE;
+}
+
+/**
+ * LinkedListGetPoolStats() copies out the allocation counters for ListItems. capacity is
+ * LINKED_LIST_POOL_SIZE (0 when ListItems come from the heap), inUse is the number of live
+ * ListItems, highWater is the largest inUse has ever been and exhausted counts the allocations that
+ * failed because the pool (or the heap) was empty. heapBytes is what the library's live malloc()s
+ * cost, LINKED_LIST_HEAP_OVERHEAD included, so LINKED_LIST_HEAP_SIZE - heapBytes is the headroom
+ * left, and fallbacks counts the ListItems taken from the pool because of LINKED_LIST_HEAP_RESERVE.
+ *
+ * @param stats Where to store the counters.
+ * @return SUCCESS or STANDARD_ERROR if stats is NULL.
+ */
+int LinkedListGetPoolStats(LinkedListPoolStats *stats)
+{
+    if (stats == NULL) {
+        return STANDARD_ERROR;
+    }
+    *stats = poolStats;
+    return SUCCESS;
+}
+
+/**
+ * LinkedListGetFootprint() adds up the memory used by the list that list is part of, see
+ * LinkedListFootprint. It walks the whole list.
+ *
+ * @param list Any element in the list. May be NULL for an empty list.
+ * @param footprint Where to store the totals.
+ * @return SUCCESS or STANDARD_ERROR if footprint is NULL.
+ */
+int LinkedListGetFootprint(ListItem *list, LinkedListFootprint *footprint)
+{
+    if (footprint == NULL) {
+        return STANDARD_ERROR;
+    }
+    memset(footprint, 0, sizeof (*footprint));
+    ListItem *item;
+    for (item = LinkedListGetFirst(list); item != NULL; item = item->nextItem) {
+        footprint->items++;
+        if (item->flags & LIST_ITEM_BLOCK) {
+            footprint->blockBytes += sizeof (ListItem);
+        } else if (LinkedListInPool(item)) {
+            footprint->poolBytes += sizeof (ListItem);
+        } else {
+            footprint->heapBytes += sizeof (ListItem) + LINKED_LIST_HEAP_OVERHEAD;
+        }
+        if (item->data != NULL) {
+            footprint->dataBytes += item->length + 1;
+        }
+    }
+    return SUCCESS;
+}
+
+#ifdef LINKED_LIST_STATS
+/**
+ * LinkedListGetStats() copies out the hot-path counters.
+ *
+ * @param stats Where to store the counters.
+ * @return SUCCESS or STANDARD_ERROR if stats is NULL.
+ */
+int LinkedListGetStats(LinkedListStats *stats)
+{
+    if (stats == NULL) {
+        return STANDARD_ERROR;
+    }
+    *stats = hotStats;
+    return SUCCESS;
+}
+
+/**
+ * LinkedListStatsReset() sets every counter back to 0, except live, and peakLive to live.
+ */
+void LinkedListStatsReset(void)
+{
+    uint32_t live = hotStats.live;
+    memset(&hotStats, 0, sizeof (hotStats));
+    hotStats.live = live;
+    hotStats.peakLive = live;
+}
+
+/**
+ * LinkedListStatsDump() prints every counter to stdout, which BOARD_Init() routes to the UART, one
+ * "STATS,name,value" line each.
+ */
+void LinkedListStatsDump(void)
+{
+    printf("STATS,allocations,%lu\n", (unsigned long) hotStats.allocations);
+    printf("STATS,frees,%lu\n", (unsigned long) hotStats.frees);
+    printf("STATS,firstVisits,%lu\n", (unsigned long) hotStats.firstVisits);
+    printf("STATS,sizeVisits,%lu\n", (unsigned long) hotStats.sizeVisits);
+    printf("STATS,comparisons,%lu\n", (unsigned long) hotStats.comparisons);
+    printf("STATS,swaps,%lu\n", (unsigned long) hotStats.swaps);
+    printf("STATS,live,%lu\n", (unsigned long) hotStats.live);
+    printf("STATS,peakLive,%lu\n", (unsigned long) hotStats.peakLive);
+}
+#endif
+
+/**
+ * PrintBufferAppend() copies length bytes of text into out, flushing it every time it fills up.
+ */
+static void PrintBufferAppend(PrintBuffer *out, const char *text, int length)
+{
+    int chunk;
+    while (length > 0) {
+        chunk = out->size - out->used;
+        if (chunk > length) {
+            chunk = length;
+        }
+        memcpy(out->buffer + out->used, text, chunk);
+        out->used += chunk;
+        text += chunk;
+        length -= chunk;
+        if (out->used == out->size) {
+            out->flush(out->buffer, out->used);
+            out->used = 0;
+        }
+    }
+}
+
+/**
+ * LinkedListFormat() writes the text LinkedListPrint() prints for the list starting at head into
+ * out and flushes whatever is left over at the end.
+ */
+static void LinkedListFormat(ListItem *head, PrintBuffer *out)
+{
+    PrintBufferAppend(out, "{", 1);
+    while (head != NULL) {
+        if (head->data == NULL) {
+            PrintBufferAppend(out, "-(null)-", 8);
+        } else {
+            PrintBufferAppend(out, "-", 1);
+            PrintBufferAppend(out, head->data, head->length);
+            PrintBufferAppend(out, "-", 1);
+        }
+        head = head->nextItem;
+    }
+    PrintBufferAppend(out, "}\n", 2);
+    if (out->used > 0) {
+        out->flush(out->buffer, out->used);
+        out->used = 0;
+    }
+}
+
+/**
+ * StdoutFlush() is the PrintBuffer flush function for blocking output through stdio.
+ */
+static int StdoutFlush(const char *text, int length)
+{
+    return fwrite(text, 1, length, stdout);
+}
+
+/**
+ * LinkedListPrint() prints out the complete list to stdout. This function prints out the given
+ * list, starting at the head if the provided pointer is not the head of the list, like "[STRING1,
+ * STRING2, ... ]" If LinkedListPrint() is called with a NULL list it does nothing, returning
+ * STANDARD_ERROR. If passed a valid pointer, prints the list and returns SUCCESS. The output is
+ * collected in a static buffer of LINKED_LIST_PRINT_BUFFER_SIZE bytes and written out in chunks,
+ * see LinkedListPrintBuffered().
+ *
+ * @param list Any element in the list to print.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers.
+ */
+int LinkedListPrint(ListItem *list)
+{
+    return LinkedListPrintBuffered(list, NULL, 0);
+}
+
+/**
+ * LinkedListPrintBuffered() prints the same text as LinkedListPrint(), but instead of one printf()
+ * per item it copies the strings into buffer and writes the buffer to stdout with a single
+ * fwrite() every time it fills up. Larger buffers mean fewer, larger writes.
+ *
+ * @param list Any element in the list to print.
+ * @param buffer Scratch space for the output. If NULL, a static buffer of
+ *               LINKED_LIST_PRINT_BUFFER_SIZE bytes is used instead.
+ * @param size The size of buffer in bytes. Ignored if buffer is NULL.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL or size is not positive.
+ */
+int LinkedListPrintBuffered(ListItem *list, char *buffer, int size)
+{
+    if (list == NULL) {
+        return STANDARD_ERROR;
+    }
+    if (buffer == NULL) {
+        buffer = printBuffer;
+        size = LINKED_LIST_PRINT_BUFFER_SIZE;
+    } else if (size <= 0) {
+        return STANDARD_ERROR;
+    }
+    PrintBuffer out = {buffer, size, 0, StdoutFlush};
+    LinkedListFormat(LinkedListGetFirst(list), &out);
+    return SUCCESS;
+}
+
+/**
+ * LinkedListQueuePiece() queues the part of text not queued yet by an earlier call, where text
+ * starts start bytes into the output of the current phase and state->offset bytes of that output
+ * are queued already. It returns TRUE if all of text is queued now.
+ */
+static int LinkedListQueuePiece(LinkedListPrintState *state, int start, const char *text,
+        int length)
+{
+    int skip = state->offset - start;
+    if (skip >= length) {
+        return TRUE;
+    }
+    int written = UartQueueWrite(text + skip, length - skip);
+    state->offset += written;
+    return written == length - skip;
+}
+
+/**
+ * LinkedListPrintQueuedBegin() starts printing the same text as LinkedListPrint() without waiting
+ * for the UART, see LinkedListPrintQueued(). Nothing is queued yet.
+ *
+ * @param state Where to keep the progress of the print.
+ * @param list Any element in the list to print.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers.
+ */
+int LinkedListPrintQueuedBegin(LinkedListPrintState *state, ListItem *list)
+{
+    if (state == NULL || list == NULL) {
+        return STANDARD_ERROR;
+    }
+    state->item = LinkedListGetFirst(list);
+    state->offset = 0;
+    state->phase = PRINT_PHASE_OPEN;
+    return SUCCESS;
+}
+
+/**
+ * LinkedListPrintQueued() copies as much of the text set up by LinkedListPrintQueuedBegin() into
+ * the UartQueue transmit buffer as fits right now, and remembers where it stopped. The UART
+ * interrupt sends it while the caller carries on, so a list of any length is printed by calling
+ * this from the main loop until it returns TRUE, without ever blocking. The list must not change
+ * until then. UartQueueInit() must have been called first.
+ *
+ * @param state The state set up by LinkedListPrintQueuedBegin().
+ * @return TRUE once the whole list is queued, FALSE if more calls are needed.
+ */
+int LinkedListPrintQueued(LinkedListPrintState *state)
+{
+    ListItem *item;
+    int queued;
+
+    while (state->phase != PRINT_PHASE_DONE) {
+        if (state->phase == PRINT_PHASE_OPEN) {
+            if (!LinkedListQueuePiece(state, 0, "{", 1)) {
+                return FALSE;
+            }
+            state->phase = PRINT_PHASE_ITEMS;
+        } else if (state->phase == PRINT_PHASE_ITEMS && state->item != NULL) {
+            // An item goes out in up to three pieces, skipping what an earlier call queued.
+            item = state->item;
+            if (item->data == NULL) {
+                queued = LinkedListQueuePiece(state, 0, "-(null)-", 8);
+            } else {
+                queued = LinkedListQueuePiece(state, 0, "-", 1)
+                        && LinkedListQueuePiece(state, 1, item->data, item->length)
+                        && LinkedListQueuePiece(state, item->length + 1, "-", 1);
+            }
+            if (!queued) {
+                return FALSE;
+            }
+            state->item = item->nextItem;
+        } else if (state->phase == PRINT_PHASE_ITEMS) {
+            state->phase = PRINT_PHASE_CLOSE;
+        } else {
+            if (!LinkedListQueuePiece(state, 0, "}\n", 2)) {
+                return FALSE;
+            }
+            state->phase = PRINT_PHASE_DONE;
+        }
+        state->offset = 0;
+    }
+    return TRUE;
+}
+
+/**
+ * LinkedListInit() sets up an empty LinkedList header. A header is optional: it tracks the head,
+ * tail and size of one list so that LinkedListSize(), LinkedListGetFirst() and LinkedListGetLast()
+ * no longer have to walk the chain. Once a header owns a list, LinkedListCreateAfter() and
+ * LinkedListRemove() keep it up to date.
+ *
+ * @param list The header to initialize.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL.
+ */
+int LinkedListInit(LinkedList *list)
+{
+    if (list == NULL) {
+        return STANDARD_ERROR;
+    }
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->sorted = TRUE;
+    return SUCCESS;
+}
+
+/**
+ * LinkedListAttach() makes list the owner of the existing chain that item belongs to. This walks
+ * the chain once to count it and tag every ListItem, after which the O(1) queries apply. A header
+ * that tracked the chain before is no longer valid afterwards.
+ *
+ * @param list An initialized header.
+ * @param item Any element of the chain to track. May be NULL for an empty list.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL.
+ */
+int LinkedListAttach(LinkedList *list, ListItem *item)
+{
+    if (list == NULL) {
+        return STANDARD_ERROR;
+    }
+    LinkedListInit(list);
+    if (item == NULL) {
+        return SUCCESS;
+    }
+    // Clear the old owner first so the walks below do not take the O(1) shortcut.
+    item->owner = NULL;
+    list->head = LinkedListGetFirst(item);
+    for (item = list->head; item != NULL; item = item->nextItem) {
+        item->owner = list;
+        list->tail = item;
+        list->size++;
+    }
+    list->sorted = (list->size <= 1);
+    return SUCCESS;
+}
+
+/**
+ * LinkedListAppend() creates a new ListItem holding data at the end of the list owned by list. On
+ * an empty list the new item becomes both head and tail.
+ *
+ * @param list An initialized header.
+ * @param data The data the new ListItem will point to. May be NULL.
+ * @return A pointer to the new ListItem, or NULL if list is NULL or no ListItem could be allocated.
+ */
+ListItem *LinkedListAppend(LinkedList *list, char *data)
+{
+    if (list == NULL) {
+        return NULL;
+    }
+    if (list->tail != NULL) {
+        return LinkedListCreateAfter(list->tail, data);
+    }
+    ListItem *new = LinkedListNew(data);
+    if (new == NULL) {
+        return NULL;
+    }
+    new->owner = list;
+    list->head = new;
+    list->tail = new;
+    list->size = 1;
+    return new;
+}
+
+/**
+ * LinkedListInsertSorted() creates a new ListItem holding data and inserts it at its place in the
+ * sorted list owned by list, after any items that compare equal to it, so the list stays sorted
+ * without calling LinkedListSort() again. The place is searched for from the tail backwards, which
+ * makes appending words that arrive roughly in order close to O(1) and is O(n) at worst. If list is
+ * not marked as sorted it is sorted first.
+ *
+ * @param list An initialized header.
+ * @param data The data the new ListItem will point to. May be NULL.
+ * @return A pointer to the new ListItem, or NULL if list is NULL or no ListItem could be allocated.
+ */
+ListItem *LinkedListInsertSorted(LinkedList *list, char *data)
+{
+    if (list == NULL) {
+        return NULL;
+    }
+    if (!list->sorted) {
+        LinkedListSort(list->head);
+    }
+    ListItem *new = LinkedListNew(data);
+    if (new == NULL) {
+        return NULL;
+    }
+    ListItem *before = list->tail;
+    while (before != NULL && LinkedListCompare(before, new) > 0) {
+        before = before->previousItem;
+    }
+
+    new->owner = list;
+    new->previousItem = before;
+    if (before == NULL) {
+        new->nextItem = list->head;
+        list->head = new;
+    } else {
+        new->nextItem = before->nextItem;
+        before->nextItem = new;
+    }
+    if (new->nextItem == NULL) {
+        list->tail = new;
+    } else {
+        new->nextItem->previousItem = new;
+    }
+    list->size++;
+    return new;
+}
+
+/**
+ * LinkedListCount() returns the number of ListItems in the list owned by list in O(1).
+ *
+ * @param list A header.
+ * @return The number of ListItems in the list (0 if `list` was NULL).
+ */
+int LinkedListCount(const LinkedList *list)
+{
+    return (list == NULL) ? 0 : list->size;
+}
+
+/**
+ * LinkedListHead() returns the first ListItem of the list owned by list in O(1).
+ *
+ * @param list A header.
+ * @return The first element in the list. Or NULL if the list is empty or `list` was NULL.
+ */
+ListItem *LinkedListHead(const LinkedList *list)
+{
+    return (list == NULL) ? NULL : list->head;
+}
+
+/**
+ * LinkedListTail() returns the last ListItem of the list owned by list in O(1).
+ *
+ * @param list A header.
+ * @return The last element in the list. Or NULL if the list is empty or `list` was NULL.
+ */
+ListItem *LinkedListTail(const LinkedList *list)
+{
+    return (list == NULL) ? NULL : list->tail;
 }
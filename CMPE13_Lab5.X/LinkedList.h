@@ -0,0 +1,765 @@
+#ifndef LINKEDLIST_H
+#define LINKEDLIST_H
+
+/**
+ * @file
+ * This file provided a doubly-linked list implementation for storing strings (NULL-terminated
+ * character arrays.
+ * The list implementation relies on a chain metaphor: a list is merely a sequence of links
+ * (ListItems) and there is no separate construct to represent the entire list, each ListItem in it
+ * does that implicitly.
+ * ListItems can store pointers to strings, but the strings themselves must be stored somewhere else.
+ * This list supports NULL pointers as well.
+ */
+
+#include <stdint.h>
+
+/**
+ * ListItems normally come from malloc(). Define LINKED_LIST_POOL_SIZE to a positive number (for
+ * example with -DLINKED_LIST_POOL_SIZE=64 in the project's preprocessor macros) to take them from a
+ * statically allocated pool of that many items instead. The pool has no per-item heap overhead,
+ * never fragments and allocates and frees in O(1). LinkedListNew() returns NULL once it is empty.
+ */
+#ifndef LINKED_LIST_POOL_SIZE
+#define LINKED_LIST_POOL_SIZE 0
+#endif
+
+/**
+ * The heap size set in the project, in bytes, and what every malloc() costs on top of the bytes it
+ * asked for. LinkedList.c charges its own malloc()s against this budget to know how much headroom
+ * is left; it cannot see what the rest of the program allocates, so lower LINKED_LIST_HEAP_SIZE by
+ * that much if it is significant.
+ */
+#ifndef LINKED_LIST_HEAP_SIZE
+#define LINKED_LIST_HEAP_SIZE 1024
+#endif
+#ifndef LINKED_LIST_HEAP_OVERHEAD
+#define LINKED_LIST_HEAP_OVERHEAD 8
+#endif
+
+/**
+ * Set LINKED_LIST_HEAP_RESERVE to a positive number of bytes, together with LINKED_LIST_POOL_SIZE,
+ * to mix both sources of ListItems: they come from malloc() as long as that leaves at least this
+ * much of LINKED_LIST_HEAP_SIZE free, and from the node pool once the heap runs low or malloc()
+ * fails. Large batches of ListItems then keep working after the heap is spent, until the pool is
+ * empty too.
+ */
+#ifndef LINKED_LIST_HEAP_RESERVE
+#define LINKED_LIST_HEAP_RESERVE 0
+#endif
+
+/**
+ * The size of the static buffer LinkedListPrint() formats into.
+ */
+#ifndef LINKED_LIST_PRINT_BUFFER_SIZE
+#define LINKED_LIST_PRINT_BUFFER_SIZE 64
+#endif
+
+/**
+ * Define LINKED_LIST_INTERN to intern the strings stored in ListItems, see LinkedListSetData().
+ * The intern table holds up to three quarters of WORD_TABLE_CAPACITY distinct strings.
+ */
+//#define LINKED_LIST_INTERN
+
+/**
+ * Define LINKED_LIST_STATS to count what the library spends its time on, see LinkedListStatsDump().
+ * Without it the counters and their updates compile to nothing.
+ */
+//#define LINKED_LIST_STATS
+
+/**
+ * LinkedListSortRadix() keeps a separate bucket for every word length up to this one.
+ */
+#ifndef LINKED_LIST_RADIX_MAX_LENGTH
+#define LINKED_LIST_RADIX_MAX_LENGTH 16
+#endif
+
+/**
+ * The most lists LinkedListMergeSorted() can merge in one call.
+ */
+#ifndef LINKED_LIST_MERGE_MAX_LISTS
+#define LINKED_LIST_MERGE_MAX_LISTS 16
+#endif
+
+/**
+ * This is the struct that will hold an individual list item. This is a doubly-linked list and
+ * so there is no need to have a separate list struct that holds all of the individual list items
+ * as they're already chained together. Note that the data is a (void *), which means that it can
+ * hold any type of pointer, even pointers to multi-dimensional arrays. This also means that any
+ * data stored in a list item must first be allocated. The length of data is cached in length, and
+ * sortKey packs it together with the first characters so that most comparisons are a single
+ * integer compare. Both are kept in sync by LinkedListSetData() and LinkedListSwapData(), as is
+ * wordId, the interned id of data (0 if data is NULL or not interned). owner points to the
+ * LinkedList header tracking the item, if any, and flags is private to LinkedList.c.
+ */
+typedef struct ListItem {
+	struct ListItem *previousItem;
+	struct ListItem *nextItem;
+	char *data;
+	unsigned int length;
+	uint32_t sortKey;
+	struct LinkedList *owner;
+	unsigned short wordId;
+	unsigned char flags;
+} ListItem;
+
+/**
+ * An optional header for a list. It tracks the head, tail and number of items so that these can be
+ * read in O(1); every ListItem in a tracked list points back to it through owner, which is NULL for
+ * lists without a header. The plain ListItem functions keep working on tracked lists and keep the
+ * header up to date. sorted is TRUE while the list is known to be in LinkedListSort() order.
+ */
+typedef struct LinkedList {
+	ListItem *head;
+	ListItem *tail;
+	int size;
+	int sorted;
+} LinkedList;
+
+/**
+ * The type of the callback LinkedListFreeRange() and LinkedListFreeAll() use to release data.
+ */
+typedef void (*LinkedListFreeDataFunction)(char *data);
+
+/**
+ * The progress of a sort spread over several LinkedListSortStep() calls. All fields are private
+ * to LinkedList.c, except that head is the head of the sorted list once LinkedListSortDone().
+ */
+typedef struct LinkedListSortState {
+	ListItem *head;
+	ListItem *tail;
+	ListItem *left;
+	ListItem *right;
+	int width;
+	int merges;
+	int leftSize;
+	int rightSize;
+	int phase;
+} LinkedListSortState;
+
+/**
+ * The progress of a print spread over several LinkedListPrintQueued() calls. All fields are
+ * private to LinkedList.c.
+ */
+typedef struct LinkedListPrintState {
+	ListItem *item;
+	int offset;
+	int phase;
+} LinkedListPrintState;
+
+/**
+ * Allocation counters for ListItems, filled in by LinkedListGetPoolStats().
+ */
+typedef struct LinkedListPoolStats {
+	int capacity;
+	int inUse;
+	int highWater;
+	int exhausted;
+	int heapBytes;
+	int fallbacks;
+} LinkedListPoolStats;
+
+/**
+ * The memory a list takes up, filled in by LinkedListGetFootprint(). heapBytes, poolBytes and
+ * blockBytes split the ListItems by where they came from: individually from malloc() (including
+ * LINKED_LIST_HEAP_OVERHEAD per item), from the node pool and from LinkedListFromArray() blocks.
+ * dataBytes adds up the strings, terminators included, once per ListItem even where items share a
+ * string.
+ */
+typedef struct LinkedListFootprint {
+	int items;
+	int heapBytes;
+	int poolBytes;
+	int blockBytes;
+	int dataBytes;
+} LinkedListFootprint;
+
+/**
+ * One of the most frequent words found by LinkedListTopK(): the first ListItem holding it and the
+ * number of ListItems that do.
+ */
+typedef struct LinkedListTopWord {
+	ListItem *item;
+	int count;
+} LinkedListTopWord;
+
+#ifdef LINKED_LIST_STATS
+/**
+ * Hot-path counters, filled in by LinkedListGetStats(). allocations and frees count ListItems taken
+ * from and given back to the heap or the pool (a LinkedListFromArray() block is one allocation and
+ * one free), firstVisits and sizeVisits count the items walked by LinkedListGetFirst() and
+ * LinkedListSize(), comparisons counts LinkedListCompare() calls, swaps counts the items the merge sort
+ * moved ahead of an earlier item plus LinkedListSwapData() calls, and peakLive is the most
+ * ListItems alive at once since the last LinkedListStatsReset().
+ */
+typedef struct LinkedListStats {
+	uint32_t allocations;
+	uint32_t frees;
+	uint32_t firstVisits;
+	uint32_t sizeVisits;
+	uint32_t comparisons;
+	uint32_t swaps;
+	uint32_t live;
+	uint32_t peakLive;
+} LinkedListStats;
+#endif
+
+/**
+ * This function starts a new linked list. Given an allocated pointer to data it will return a
+ * pointer for a malloc()ed ListItem struct. If malloc() fails for any reason, then this function
+ * returns NULL otherwise it should return a pointer to this new list item. data can be NULL.
+ *
+ * @param data The data to be stored in the first ListItem in this new list. Can be any valid 
+ *             pointer value.
+ * @return A pointer to the malloc()'d ListItem. May be NULL if an error occured.
+ */
+ListItem *LinkedListNew(char *data);
+
+/**
+ * LinkedListSetData() stores data in item and refreshes the cached length that LinkedListSort()
+ * and the word counting code rely on. Always go through this function (or LinkedListSwapData())
+ * instead of assigning item->data directly, otherwise the cached length goes stale.
+ *
+ * If LINKED_LIST_INTERN is defined, data is also interned: the first pointer seen for every
+ * distinct string becomes its canonical pointer and is stored instead of any later pointer to an
+ * equal string, along with a small id in wordId. Equal words then share one pointer and one id, so
+ * telling them apart never needs strcmp(). This means the data pointer stored (and eventually
+ * returned by LinkedListRemove()) may not be the one that was passed in, and that interned strings
+ * must stay valid until LinkedListInternReset(). Once the intern table is full new strings are
+ * stored as they are, with a wordId of 0.
+ *
+ * @param item The ListItem to update.
+ * @param data The new data pointer. May be NULL.
+ * @return SUCCESS or STANDARD_ERROR if item is NULL.
+ */
+int LinkedListSetData(ListItem *item, char *data);
+
+/**
+ * LinkedListSetKnownData() is LinkedListSetData() for data whose length and sort key are already
+ * known, such as the words of a generated table, so that storing it does not read the string.
+ * sortKey must be packed the way LinkedListSetData() packs it: the length plus one in the top byte
+ * followed by the first three characters, big-endian and zero padded, or 0xFF000000 for strings
+ * longer than 253 characters. gen_dictionary.py generates such keys. Interning still hashes data
+ * when LINKED_LIST_INTERN is defined.
+ *
+ * @param item The ListItem to update.
+ * @param data The new data pointer. May be NULL, in which case length and sortKey are ignored.
+ * @param length The length of data, as returned by strlen().
+ * @param sortKey The sort key of data.
+ * @return SUCCESS or STANDARD_ERROR if item is NULL.
+ */
+int LinkedListSetKnownData(ListItem *item, char *data, unsigned int length, uint32_t sortKey);
+
+/**
+ * LinkedListInitProbe() fills in a ListItem that is not part of any list, so that it can be passed
+ * to LinkedListCompare() and LinkedListEqual() to compare list items against a plain string, for
+ * example one on the stack. Unlike LinkedListSetData() it never adds data to the intern table; if
+ * LINKED_LIST_INTERN is defined and data is already interned, the probe gets its wordId.
+ *
+ * @param probe The ListItem to fill in. Its links and owner are cleared.
+ * @param data The string to compare against. May be NULL.
+ */
+void LinkedListInitProbe(ListItem *probe, char *data);
+
+#ifdef LINKED_LIST_INTERN
+/**
+ * LinkedListInternReset() forgets every interned string, so that their memory can be reused. Only
+ * call it when no ListItem holding interned data is left, otherwise old and new ids get mixed up.
+ */
+void LinkedListInternReset(void);
+#endif
+
+/**
+ * LinkedListFromArray() builds a list holding the n strings of words, in that order, with a single
+ * malloc() for all of its ListItems. The items sit next to each other in memory, which is cheaper
+ * than n calls to LinkedListCreateAfter() and faster to walk. The items can be used like any other
+ * ListItem, including LinkedListRemove(), but their memory is only given back when the whole block
+ * is released with LinkedListFreeArray(). The block always comes from the heap, even if
+ * LINKED_LIST_POOL_SIZE is set.
+ *
+ * @param words The data for the new ListItems. Entries may be NULL.
+ * @param n The number of entries in words.
+ * @return The first ListItem of the block, which is also the head of the new list, or NULL if n is
+ *         not positive or malloc() failed. Keep this pointer for LinkedListFreeArray(): once the
+ *         list is sorted it is not necessarily the head anymore.
+ */
+ListItem *LinkedListFromArray(char **words, int n);
+
+/**
+ * LinkedListFreeArray() releases a block created by LinkedListFromArray() with a single free().
+ * Items of the block that are still part of a list are removed from it first, so the block may have
+ * been sorted or mixed with other ListItems. The data pointers are not freed.
+ *
+ * @param block The pointer returned by LinkedListFromArray().
+ * @param n The number of ListItems in the block, as passed to LinkedListFromArray().
+ * @return SUCCESS or STANDARD_ERROR if block is NULL or n is not positive.
+ */
+int LinkedListFreeArray(ListItem *block, int n);
+
+/**
+ * This function will remove a list item from the linked list and free() the memory that the
+ * ListItem struct was using. It doesn't, however, free() the data pointer and instead returns it
+ * so that the calling code can manage it.  If passed a pointer to NULL, LinkedListRemove() should
+ * return NULL to signal an error.
+ *
+ * @param item The ListItem to remove from the list.
+ * @return The data pointer from the removed item. May be NULL.
+ */
+char *LinkedListRemove(ListItem *item);
+
+/**
+ * LinkedListFreeRange() removes the ListItems from first up to and including last from their list
+ * and frees them in a single pass. Only the neighbours just outside the range are relinked, and a
+ * LinkedList header tracking the list is updated once. If freeData is not NULL it is called with
+ * every non-NULL data pointer in the range before its ListItem is freed. Works the same whether the
+ * ListItems come from the heap, the node pool or a LinkedListFromArray() block. With
+ * LINKED_LIST_INTERN equal strings share one pointer, so freeData should be NULL in that case.
+ *
+ * @param first The first ListItem to free.
+ * @param last The last ListItem to free. Must be first or come after it in the same list. If NULL,
+ *             everything from first to the end of the list is freed.
+ * @param freeData Called on every data pointer that is freed. May be NULL.
+ * @return SUCCESS or STANDARD_ERROR if first is NULL.
+ */
+int LinkedListFreeRange(ListItem *first, ListItem *last, LinkedListFreeDataFunction freeData);
+
+/**
+ * LinkedListFreeAll() frees every ListItem of the list that any belongs to in a single pass, see
+ * LinkedListFreeRange().
+ *
+ * @param any Any element in the list to free.
+ * @param freeData Called on every data pointer that is freed. May be NULL.
+ * @return SUCCESS or STANDARD_ERROR if any is NULL.
+ */
+int LinkedListFreeAll(ListItem *any, LinkedListFreeDataFunction freeData);
+
+/**
+ * This function returns the total size of the linked list. This means that even if it is passed a
+ * ListItem that is not at the head of the list, it should still return the total number of
+ * ListItems in the list. A NULL argument will result in 0 being returned. If the list is tracked by
+ * a LinkedList header this is O(1), otherwise the whole list is walked.
+ *
+ * @param list An item in the list to be sized.
+ * @return The number of ListItems in the list (0 if `list` was NULL).
+ */
+int LinkedListSize(ListItem *list);
+
+/**
+ * This function returns the head of a list given some element in the list. If it is passed NULL,
+ * it will just return NULL. If given the head of the list it will just return the pointer to the
+ * head anyways for consistency. If the list is tracked by a LinkedList header this is O(1).
+ *
+ * @param list An element in a list.
+ * @return The first element in the list. Or NULL if provided an invalid list.
+ */
+ListItem *LinkedListGetFirst(ListItem *list);
+
+/**
+ * LinkedListGetLast() is the counterpart to LinkedListGetFirst(): it returns the tail of the list
+ * that list is part of, or NULL if passed NULL. If the list is tracked by a LinkedList header this
+ * is O(1).
+ *
+ * @param list An element in a list.
+ * @return The last element in the list. Or NULL if provided an invalid list.
+ */
+ListItem *LinkedListGetLast(ListItem *list);
+
+/**
+ * This function allocates a new ListItem containing data and inserts it into the list directly
+ * after item. It rearranges the pointers of other elements in the list to make this happen. If
+ * passed a NULL item, InsertAfter() should still create a new ListItem, just with no previousItem.
+ * It returns NULL if it can't malloc() a new ListItem, otherwise it returns a pointer to the new
+ * item. The data parameter is also allowed to be NULL.
+ *
+ * @param item The ListItem that will be before the newly-created ListItem.
+ * @param data The data the new ListItem will point to.
+ * @return A pointer to the newly-malloc()'d ListItem.
+ */
+ListItem *LinkedListCreateAfter(ListItem *item, char *data);
+
+/**
+ * LinkedListSplice() moves the run of ListItems from first up to and including last out of its
+ * list and links it in right after dst, by relinking the ends of the run only. Nothing is allocated
+ * or copied. dst may be in the same list as the run, as long as it is not part of it. This is O(1)
+ * when the run stays under the same LinkedList header (or neither list has one). Moving it between
+ * headers takes one walk over the run to update the items' owner and both sizes, and so does
+ * LINKED_LIST_INTERN, which has to forget the first occurrences of the moved words.
+ *
+ * @param dst The ListItem to insert the run after.
+ * @param first The first ListItem of the run.
+ * @param last The last ListItem of the run. Must be first or come after it in the same list.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers or dst is one of the ends of the run.
+ */
+int LinkedListSplice(ListItem *dst, ListItem *first, ListItem *last);
+
+/**
+ * LinkedListSplit() cuts the list in two right before at. The items before at stay where they are,
+ * including under their LinkedList header, and at becomes the head of a new list of its own that no
+ * header tracks. This is O(1) for a list without a header, and takes one walk over the new list to
+ * clear the items' owner otherwise.
+ *
+ * @param at The first ListItem of the new list.
+ * @return at, now the head of the new list, or NULL if at is NULL.
+ */
+ListItem *LinkedListSplit(ListItem *at);
+
+/**
+ * LinkedListConcat() moves the whole list that b belongs to onto the end of the list that a belongs
+ * to, see LinkedListSplice(). The tail of a's list and the ends of b's list are found through their
+ * LinkedList headers, or by walking if there are none, so this is O(1) when both lists have headers
+ * (plus the walk LinkedListSplice() needs between two headers) or when a is the tail and b the head
+ * of a list without a header. Afterwards b's header, if any, is empty.
+ *
+ * @param a Any element of the list to append to.
+ * @param b Any element of the list to append.
+ * @return The head of the combined list, or NULL if passed NULL pointers or both are in one list.
+ */
+ListItem *LinkedListConcat(ListItem *a, ListItem *b);
+
+/**
+ * LinkedListSwapData() switches the data pointers of the two provided ListItems. This is most
+ * useful when trying to reorder ListItems but when you want to preserve their location. It is used
+ * within LinkedListSort() for swapping items, but probably isn't too useful otherwise. This
+ * function should return STANDARD_ERROR if either arguments are NULL, otherwise it should return
+ * SUCCESS. If one or both of the data pointers are NULL in the given ListItems, it still does
+ * perform the swap and returns SUCCESS. The LinkedList headers of both items, if any, are no longer
+ * marked as sorted afterwards.
+ *
+ * @param firstItem One of the items whose data will be swapped.
+ * @param secondItem Another item whose data will be swapped.
+ * @return SUCCESS if the swap worked or STANDARD_ERROR if it failed.
+ */
+int LinkedListSwapData(ListItem *firstItem, ListItem *secondItem);
+
+/**
+ * LinkedListCompare() orders two list items the way LinkedListSort() does: NULL data first, then
+ * by string length, then alphabetically. Most pairs are decided by a single compare of the packed
+ * sort keys cached by LinkedListSetData(); FastStringCompare() only runs, past the first three
+ * characters, on strings of the same length that start the same way.
+ *
+ * @param firstItem The item on the left-hand side of the comparison.
+ * @param secondItem The item on the right-hand side of the comparison.
+ * @return A negative number if firstItem sorts before secondItem, zero if they sort the same and
+ *         a positive number otherwise.
+ */
+int LinkedListCompare(const ListItem *firstItem, const ListItem *secondItem);
+
+/**
+ * LinkedListEqual() checks whether two list items hold the same word. Two NULL data pointers are
+ * equal to each other but never to a string. Items with different sort keys or different interned
+ * ids are rejected without looking at the strings at all.
+ *
+ * @param firstItem One of the items to compare.
+ * @param secondItem The other item to compare.
+ * @return TRUE if both items hold equal data, FALSE otherwise.
+ */
+int LinkedListEqual(const ListItem *firstItem, const ListItem *secondItem);
+
+/**
+ * LinkedListWordCount() returns the word count of item in the encoding UnsortedWordCount() in
+ * sort.c uses: the number of ListItems holding the same word if item is the first of them in its
+ * list, the negative of that number if it is a later one, and 0 for NULL data.
+ *
+ * With LINKED_LIST_INTERN defined this is an online count: every intern table entry tracks how
+ * many live ListItems hold its word, updated in O(1) whenever an item is created, changed or freed,
+ * and remembers which of them comes first. An insert in the middle of the list, a data change or a
+ * swap only marks the first occurrence of the affected word as unknown, and only then is it looked
+ * up again, once. Sorting finds all of them again in one pass. So filling in a whole wordCount array
+ * costs O(n) plus a walk for each word changed since the last call, instead of O(n^2). The counts
+ * cover every live ListItem, so meaningful results need the counted list to be the only one holding
+ * these words. Without LINKED_LIST_INTERN, or for words that did not fit into the intern table,
+ * item's list is walked instead.
+ *
+ * @param item The ListItem to count.
+ * @return The signed count, or 0 if item is NULL or holds NULL.
+ */
+int LinkedListWordCount(const ListItem *item);
+
+/**
+ * LinkedListSort() performs a bottom-up merge sort on list to sort the elements into ascending
+ * order. Instead of swapping data pointers it relinks the nextItem and previousItem pointers, so
+ * every ListItem keeps its data but may end up at a different position in the list. In particular
+ * the item passed in is not necessarily the head afterwards, so use LinkedListGetFirst() to find
+ * the new head. This function sorts the strings in ascending order first by size (with NULL data
+ * pointers sorting before every string) and then alphabetically ascending order. So the list [dog,
+ * cat, duck, goat, NULL] will be sorted to [NULL, cat, dog, duck, goat]. The sort is stable: items
+ * that compare equal keep their original relative order. It runs in O(n log n) time and uses no
+ * extra memory. A list tracked by a LinkedList header remembers that it is sorted until it is next
+ * changed, and sorting it again before then returns straight away. LinkedListSort() returns
+ * SUCCESS if sorting was possible. If passed a NULL pointer for either argument, it will do nothing
+ * and return STANDARD_ERROR.
+ *
+ * @param list Any element in the list to sort.
+ * @return SUCCESS if successful or STANDARD_ERROR is passed NULL pointers.
+ */
+int LinkedListSort(ListItem *list);
+
+/**
+ * LinkedListSortRadix() sorts list into exactly the same order as LinkedListSort(), but makes use
+ * of the ordering being by length first. One pass splices every ListItem onto the end of a bucket
+ * for its length (one for NULL, one per length up to LINKED_LIST_RADIX_MAX_LENGTH and one for
+ * everything longer), so only words of the same length ever get compared to each other. Each
+ * bucket is then merge sorted on its own and the buckets are joined back together in order. Only
+ * pointers are relinked, nothing is allocated. For lists of short words this does much less work
+ * than LinkedListSort(). As with LinkedListSort(), use LinkedListGetFirst() to find the new head.
+ *
+ * @param list Any element in the list to sort.
+ * @return SUCCESS if successful or STANDARD_ERROR is passed NULL pointers.
+ */
+int LinkedListSortRadix(ListItem *list);
+
+/**
+ * LinkedListMergeSorted() merges k lists that are each sorted with LinkedListSort() into one sorted
+ * list by relinking their ListItems in place, without allocating anything. The heads of the lists
+ * are kept in a binary min-heap on the stack, so every ListItem costs O(log k) comparisons and the
+ * whole merge O(n log k). Equal items keep their order within their list, and items from an earlier
+ * entry of lists come before equal items from a later one, so the result is exactly what sorting
+ * the concatenation of the lists would give. The merged list belongs to the LinkedList header of
+ * the first non-empty list, if it has one, and every other header involved is left empty.
+ *
+ * @param lists Any element of each list to merge. Entries may be NULL for empty lists.
+ * @param k The number of entries in lists, at most LINKED_LIST_MERGE_MAX_LISTS.
+ * @return The head of the merged list, or NULL if every list was empty, lists is NULL or k is out
+ *         of range.
+ */
+ListItem *LinkedListMergeSorted(ListItem **lists, int k);
+
+/**
+ * LinkedListUniqueCount() collapses every run of equal words in a sorted list into its first
+ * ListItem in a single pass, and stores how many there were. Each run of duplicates is given back
+ * with one LinkedListFreeRange() call, so to the pool in bulk when LINKED_LIST_POOL_SIZE is set.
+ * As in SortedWordCount() in sort.c, NULL words are not strings: they are never merged and their
+ * count is 0. A list tracked by a LinkedList header that is not sorted is sorted first, any other
+ * list must already be sorted with LinkedListSort(). The list stays sorted.
+ *
+ * @param list Any element in the list.
+ * @param counts Where to store the count of every remaining ListItem, in list order. Needs room for
+ *               as many entries as the list has unique words. May be NULL.
+ * @param freeData Called on the data of every duplicate that is freed. May be NULL, and must be
+ *                 with LINKED_LIST_INTERN, see LinkedListFreeRange().
+ * @return The number of ListItems left, 0 if list is NULL.
+ */
+int LinkedListUniqueCount(ListItem *list, int *counts, LinkedListFreeDataFunction freeData);
+
+/**
+ * LinkedListTopK() finds the k words that occur most often in a list, without counting into an
+ * array as long as the list. With LINKED_LIST_INTERN defined, the words in the intern table already
+ * have their online counts, see LinkedListWordCount(), which are only read here; as there, the
+ * results are only meaningful if the list is the only one holding these words. Every other word is
+ * counted in the shared wordTableScratch, the same way as UnsortedWordCountHashed() in sort.c does,
+ * and the slots a call used are chained together and emptied one by one afterwards, so no call pays
+ * for the whole WORD_TABLE_CAPACITY. The k most frequent words are kept in a min-heap built in out,
+ * so this takes O(n + d log k) time for d distinct words and O(k) memory. If the list holds more
+ * distinct words than the table can take, the list is sorted with LinkedListSort() instead and its
+ * runs of equal words are counted, in O(n log n); only then is the list changed. Either way the
+ * ListItem stored for a word is the first one holding it, in the order before sorting. Of words
+ * that occur equally often, the one LinkedListSort() puts first ranks higher. NULL words are not
+ * counted.
+ *
+ * @param list Any element in the list.
+ * @param k The most words to find.
+ * @param out Where to store the words, most frequent first. Needs room for k entries.
+ * @return The number of words stored in out, which is less than k if the list has fewer distinct
+ *         words, or 0 if list or out is NULL or k is not positive.
+ */
+int LinkedListTopK(ListItem *list, int k, LinkedListTopWord *out);
+
+/**
+ * LinkedListSortBegin() starts sorting list into the same order as LinkedListSort(), with the same
+ * stable bottom-up merge sort, but without doing any of the work yet: LinkedListSortStep() does it
+ * a bounded slice at a time, so that a long sort can be spread over several iterations of the main
+ * loop. The list is in pieces until the sort is done, so nothing may look at it or change it in
+ * between, not even through its LinkedList header.
+ *
+ * @param state Where to keep the progress of the sort.
+ * @param list Any element in the list to sort.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers.
+ */
+int LinkedListSortBegin(LinkedListSortState *state, ListItem *list);
+
+/**
+ * LinkedListSortStep() does up to budget units of sorting work, where a unit is one ListItem
+ * walked over, compared and moved, or relinked. A whole sort of n ListItems takes at most 2n units
+ * for each of the log2(n) (rounded up) merge passes plus 4n + 4 for starting the merges and the
+ * final relink, so O(n log n), and each call costs O(budget).
+ *
+ * @param state The state set up by LinkedListSortBegin().
+ * @param budget The most units to spend.
+ * @return TRUE once the sort is done, FALSE if more steps are needed.
+ */
+int LinkedListSortStep(LinkedListSortState *state, int budget);
+
+/**
+ * LinkedListSortDone() checks whether the sort described by state is finished. The sorted list
+ * starts at state->head, and its LinkedList header, if any, is marked as sorted.
+ *
+ * @param state The state set up by LinkedListSortBegin().
+ * @return TRUE or FALSE.
+ */
+int LinkedListSortDone(const LinkedListSortState *state);
+
+/**
+ * LinkedListGetPoolStats() copies out the allocation counters for ListItems. capacity is
+ * LINKED_LIST_POOL_SIZE (0 when ListItems come from the heap), inUse is the number of live
+ * ListItems, highWater is the largest inUse has ever been and exhausted counts the allocations that
+ * failed because the pool (or the heap) was empty. heapBytes is what the library's live malloc()s
+ * cost, LINKED_LIST_HEAP_OVERHEAD included, so LINKED_LIST_HEAP_SIZE - heapBytes is the headroom
+ * left, and fallbacks counts the ListItems taken from the pool because of LINKED_LIST_HEAP_RESERVE.
+ *
+ * @param stats Where to store the counters.
+ * @return SUCCESS or STANDARD_ERROR if stats is NULL.
+ */
+int LinkedListGetPoolStats(LinkedListPoolStats *stats);
+
+/**
+ * LinkedListGetFootprint() adds up the memory used by the list that list is part of, see
+ * LinkedListFootprint. It walks the whole list.
+ *
+ * @param list Any element in the list. May be NULL for an empty list.
+ * @param footprint Where to store the totals.
+ * @return SUCCESS or STANDARD_ERROR if footprint is NULL.
+ */
+int LinkedListGetFootprint(ListItem *list, LinkedListFootprint *footprint);
+
+#ifdef LINKED_LIST_STATS
+/**
+ * LinkedListGetStats() copies out the hot-path counters.
+ *
+ * @param stats Where to store the counters.
+ * @return SUCCESS or STANDARD_ERROR if stats is NULL.
+ */
+int LinkedListGetStats(LinkedListStats *stats);
+
+/**
+ * LinkedListStatsReset() sets every counter back to 0, except live, and peakLive to live.
+ */
+void LinkedListStatsReset(void);
+
+/**
+ * LinkedListStatsDump() prints every counter to stdout, which BOARD_Init() routes to the UART, one
+ * "STATS,name,value" line each.
+ */
+void LinkedListStatsDump(void);
+#else
+#define LinkedListStatsReset()
+#define LinkedListStatsDump()
+#endif
+
+/**
+ * LinkedListPrint() prints out the complete list to stdout. This function prints out the given
+ * list, starting at the head if the provided pointer is not the head of the list, like "[STRING1,
+ * STRING2, ... ]" If LinkedListPrint() is called with a NULL list it does nothing, returning
+ * STANDARD_ERROR. If passed a valid pointer, prints the list and returns SUCCESS. The output is
+ * collected in a static buffer of LINKED_LIST_PRINT_BUFFER_SIZE bytes and written out in chunks,
+ * see LinkedListPrintBuffered().
+ *
+ * @param list Any element in the list to print.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers.
+ */
+int LinkedListPrint(ListItem *list);
+
+/**
+ * LinkedListPrintBuffered() prints the same text as LinkedListPrint(), but instead of one printf()
+ * per item it copies the strings into buffer and writes the buffer to stdout with a single
+ * fwrite() every time it fills up. Larger buffers mean fewer, larger writes.
+ *
+ * @param list Any element in the list to print.
+ * @param buffer Scratch space for the output. If NULL, a static buffer of
+ *               LINKED_LIST_PRINT_BUFFER_SIZE bytes is used instead.
+ * @param size The size of buffer in bytes. Ignored if buffer is NULL.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL or size is not positive.
+ */
+int LinkedListPrintBuffered(ListItem *list, char *buffer, int size);
+
+/**
+ * LinkedListPrintQueuedBegin() starts printing the same text as LinkedListPrint() without waiting
+ * for the UART, see LinkedListPrintQueued(). Nothing is queued yet.
+ *
+ * @param state Where to keep the progress of the print.
+ * @param list Any element in the list to print.
+ * @return SUCCESS or STANDARD_ERROR if passed NULL pointers.
+ */
+int LinkedListPrintQueuedBegin(LinkedListPrintState *state, ListItem *list);
+
+/**
+ * LinkedListPrintQueued() copies as much of the text set up by LinkedListPrintQueuedBegin() into
+ * the UartQueue transmit buffer as fits right now, and remembers where it stopped. The UART
+ * interrupt sends it while the caller carries on, so a list of any length is printed by calling
+ * this from the main loop until it returns TRUE, without ever blocking. The list must not change
+ * until then. UartQueueInit() must have been called first.
+ *
+ * @param state The state set up by LinkedListPrintQueuedBegin().
+ * @return TRUE once the whole list is queued, FALSE if more calls are needed.
+ */
+int LinkedListPrintQueued(LinkedListPrintState *state);
+
+/**
+ * LinkedListInit() sets up an empty LinkedList header. A header is optional: it tracks the head,
+ * tail and size of one list so that LinkedListSize(), LinkedListGetFirst() and LinkedListGetLast()
+ * no longer have to walk the chain. Once a header owns a list, LinkedListCreateAfter() and
+ * LinkedListRemove() keep it up to date.
+ *
+ * @param list The header to initialize.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL.
+ */
+int LinkedListInit(LinkedList *list);
+
+/**
+ * LinkedListAttach() makes list the owner of the existing chain that item belongs to. This walks
+ * the chain once to count it and tag every ListItem, after which the O(1) queries apply. A header
+ * that tracked the chain before is no longer valid afterwards.
+ *
+ * @param list An initialized header.
+ * @param item Any element of the chain to track. May be NULL for an empty list.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL.
+ */
+int LinkedListAttach(LinkedList *list, ListItem *item);
+
+/**
+ * LinkedListAppend() creates a new ListItem holding data at the end of the list owned by list. On
+ * an empty list the new item becomes both head and tail.
+ *
+ * @param list An initialized header.
+ * @param data The data the new ListItem will point to. May be NULL.
+ * @return A pointer to the new ListItem, or NULL if list is NULL or no ListItem could be allocated.
+ */
+ListItem *LinkedListAppend(LinkedList *list, char *data);
+
+/**
+ * LinkedListInsertSorted() creates a new ListItem holding data and inserts it at its place in the
+ * sorted list owned by list, after any items that compare equal to it, so the list stays sorted
+ * without calling LinkedListSort() again. The place is searched for from the tail backwards, which
+ * makes appending words that arrive roughly in order close to O(1) and is O(n) at worst. If list is
+ * not marked as sorted it is sorted first.
+ *
+ * @param list An initialized header.
+ * @param data The data the new ListItem will point to. May be NULL.
+ * @return A pointer to the new ListItem, or NULL if list is NULL or no ListItem could be allocated.
+ */
+ListItem *LinkedListInsertSorted(LinkedList *list, char *data);
+
+/**
+ * LinkedListCount() returns the number of ListItems in the list owned by list in O(1).
+ *
+ * @param list A header.
+ * @return The number of ListItems in the list (0 if `list` was NULL).
+ */
+int LinkedListCount(const LinkedList *list);
+
+/**
+ * LinkedListHead() returns the first ListItem of the list owned by list in O(1).
+ *
+ * @param list A header.
+ * @return The first element in the list. Or NULL if the list is empty or `list` was NULL.
+ */
+ListItem *LinkedListHead(const LinkedList *list);
+
+/**
+ * LinkedListTail() returns the last ListItem of the list owned by list in O(1).
+ *
+ * @param list A header.
+ * @return The last element in the list. Or NULL if the list is empty or `list` was NULL.
+ */
+ListItem *LinkedListTail(const LinkedList *list);
+
+#endif
@@ -0,0 +1,270 @@
+/**
+ * @file
+ * This file provides a skip-list index for looking words up in a list sorted by LinkedListSort().
+ * The index does not change the list, it sits on top of it: the lowest index level points at every
+ * stride-th ListItem, and every level above it at every other node of the level below.
+ */
+
+//Standard Libraries
+#include <stdio.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "SkipList.h"
+
+// **** Define any module-level, global, or external variables here ****
+// Index nodes for all skip lists. Nodes that were given back are kept on a free list chained
+// through next; nodes past poolUnused have never been used.
+static SkipListNode nodePool[SKIP_LIST_POOL_SIZE];
+static SkipListNode *freeNodes = NULL;
+static int poolUnused = 0;
+static int poolAvailable = SKIP_LIST_POOL_SIZE;
+
+/**
+ * SkipListNewNode() takes a node from the pool, or returns NULL if it is empty.
+ */
+static SkipListNode *SkipListNewNode(ListItem *item, int rank, SkipListNode *down)
+{
+    SkipListNode *node;
+    if (freeNodes != NULL) {
+        node = freeNodes;
+        freeNodes = node->next;
+    } else if (poolUnused < SKIP_LIST_POOL_SIZE) {
+        node = &nodePool[poolUnused++];
+    } else {
+        return NULL;
+    }
+    poolAvailable--;
+    node->item = item;
+    node->rank = rank;
+    node->down = down;
+    node->next = NULL;
+    return node;
+}
+
+/**
+ * SkipListNodesNeeded() returns how many nodes an index over size items with the given stride
+ * takes: one per stride items on the lowest level, and half as many, rounded up, on every level
+ * above it until a level has a single node.
+ */
+static int SkipListNodesNeeded(int size, int stride)
+{
+    int level = (size + stride - 1) / stride;
+    int total = level;
+    while (level > 1) {
+        level = (level + 1) / 2;
+        total += level;
+    }
+    return total;
+}
+
+/**
+ * SkipListSearch() returns the first ListItem that sorts after probe, or that does not sort before
+ * it if inclusive is TRUE, and stores its rank in rank (the list size if there is none).
+ */
+static ListItem *SkipListSearch(const SkipList *index, const ListItem *probe, int inclusive,
+        int *rank)
+{
+    // The item passes while it still sorts before the one being looked for.
+    int limit = inclusive ? 0 : 1;
+    const SkipListNode *node = index->top;
+    ListItem *item;
+
+    *rank = 0;
+    if (index->head == NULL || LinkedListCompare(index->head, probe) >= limit) {
+        return index->head;
+    }
+    // Every node reached from here on points at an item that passes.
+    if (node == NULL) {
+        item = index->head;
+        while (item != NULL && LinkedListCompare(item, probe) < limit) {
+            item = item->nextItem;
+            (*rank)++;
+        }
+        return item;
+    }
+    while (TRUE) {
+        while (node->next != NULL && LinkedListCompare(node->next->item, probe) < limit) {
+            node = node->next;
+        }
+        if (node->down == NULL) {
+            break;
+        }
+        node = node->down;
+    }
+    item = node->item;
+    *rank = node->rank;
+    while (item != NULL && LinkedListCompare(item, probe) < limit) {
+        item = item->nextItem;
+        (*rank)++;
+    }
+    return item;
+}
+
+/**
+ * SkipListAbandon() gives back the nodes of a build that ran out of them and leaves index as an
+ * index without nodes, where a lookup walks the list from its head.
+ */
+static int SkipListAbandon(SkipList *index)
+{
+    ListItem *head = index->head;
+    int size = index->size;
+    SkipListClear(index);
+    index->head = head;
+    index->size = size;
+    index->stride = size;
+    return SUCCESS;
+}
+
+/**
+ * SkipListBuild() builds an index over the list that list belongs to. The list must be sorted with
+ * LinkedListSort() or kept sorted with LinkedListInsertSorted(). It takes one pass over the list.
+ * The stride is the smallest power of two for which the whole index fits into the nodes left in
+ * the pool. Should the pool run out anyway, whatever was built is given back and lookups walk the
+ * list from its head.
+ *
+ * @param index Where to build the index. Any index built here before must have been cleared.
+ * @param list Any element of the sorted list. May be NULL for an empty list.
+ * @return SUCCESS or STANDARD_ERROR if index is NULL.
+ */
+int SkipListBuild(SkipList *index, ListItem *list)
+{
+    if (index == NULL) {
+        return STANDARD_ERROR;
+    }
+    index->top = NULL;
+    index->head = LinkedListGetFirst(list);
+    index->size = LinkedListSize(list);
+    index->stride = 2;
+    if (index->head == NULL) {
+        return SUCCESS;
+    }
+
+    // Raise the stride until all levels fit into the pool.
+    while (index->stride < index->size &&
+            SkipListNodesNeeded(index->size, index->stride) > poolAvailable) {
+        index->stride *= 2;
+    }
+    if (SkipListNodesNeeded(index->size, index->stride) > poolAvailable) {
+        // Without any nodes a lookup becomes a walk from the head of the list.
+        index->stride = index->size;
+        return SUCCESS;
+    }
+
+    // The lowest level points at every stride-th item. top always holds the highest level built
+    // so far, so that a build that runs out of nodes can be undone with SkipListClear().
+    SkipListNode *first, *node, *upper;
+    ListItem *item;
+    int rank;
+    first = SkipListNewNode(index->head, 0, NULL);
+    if (first == NULL) {
+        return SkipListAbandon(index);
+    }
+    index->top = first;
+    node = first;
+    for (item = index->head, rank = 0; item != NULL; item = item->nextItem, rank++) {
+        if (rank > 0 && rank % index->stride == 0) {
+            node->next = SkipListNewNode(item, rank, NULL);
+            if (node->next == NULL) {
+                return SkipListAbandon(index);
+            }
+            node = node->next;
+        }
+    }
+
+    // Every level above that points at every other node of the level below.
+    while (first->next != NULL) {
+        upper = SkipListNewNode(first->item, 0, first);
+        if (upper == NULL) {
+            return SkipListAbandon(index);
+        }
+        index->top = upper;
+        node = upper;
+        for (first = first->next; first != NULL && first->next != NULL; first = first->next->next) {
+            node->next = SkipListNewNode(first->next->item, first->next->rank, first->next);
+            if (node->next == NULL) {
+                return SkipListAbandon(index);
+            }
+            node = node->next;
+        }
+        first = upper;
+    }
+    return SUCCESS;
+}
+
+/**
+ * SkipListClear() gives the nodes of index back to the pool and leaves it empty.
+ *
+ * @param index The index to clear.
+ */
+void SkipListClear(SkipList *index)
+{
+    SkipListNode *level, *node, *next;
+    for (level = index->top; level != NULL; level = next) {
+        next = level->down;
+        while (level != NULL) {
+            node = level->next;
+            level->next = freeNodes;
+            freeNodes = level;
+            poolAvailable++;
+            level = node;
+        }
+    }
+    index->top = NULL;
+    index->head = NULL;
+    index->size = 0;
+}
+
+/**
+ * SkipListLowerBound() finds the first ListItem that does not sort before word.
+ *
+ * @param index The index to search.
+ * @param word The word to look for. May be NULL.
+ * @return The first ListItem comparing greater than or equal to word, or NULL if there is none.
+ */
+ListItem *SkipListLowerBound(const SkipList *index, char *word)
+{
+    ListItem probe;
+    int rank;
+    LinkedListInitProbe(&probe, word);
+    return SkipListSearch(index, &probe, TRUE, &rank);
+}
+
+/**
+ * SkipListFind() finds the first ListItem holding word.
+ *
+ * @param index The index to search.
+ * @param word The word to look for. May be NULL.
+ * @return The first ListItem equal to word, or NULL if word is not in the list.
+ */
+ListItem *SkipListFind(const SkipList *index, char *word)
+{
+    ListItem probe;
+    int rank;
+    LinkedListInitProbe(&probe, word);
+    ListItem *item = SkipListSearch(index, &probe, TRUE, &rank);
+    if (item == NULL || LinkedListCompare(item, &probe) != 0) {
+        return NULL;
+    }
+    return item;
+}
+
+/**
+ * SkipListCount() counts how many times word occurs in the list, with two O(log n) searches.
+ *
+ * @param index The index to search.
+ * @param word The word to count. May be NULL.
+ * @return The number of ListItems equal to word.
+ */
+int SkipListCount(const SkipList *index, char *word)
+{
+    ListItem probe;
+    int first, last;
+    LinkedListInitProbe(&probe, word);
+    SkipListSearch(index, &probe, TRUE, &first);
+    SkipListSearch(index, &probe, FALSE, &last);
+    return last - first;
+}
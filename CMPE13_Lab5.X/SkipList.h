@@ -0,0 +1,98 @@
+#ifndef SKIPLIST_H
+#define SKIPLIST_H
+
+/**
+ * @file
+ * This file provides a skip-list index for looking words up in a list sorted by LinkedListSort().
+ * The index does not change the list, it sits on top of it: the lowest index level points at every
+ * stride-th ListItem, and every level above it at every other node of the level below. Lookups go
+ * down the levels and then walk at most stride ListItems, so finding a word or counting how many
+ * times it occurs takes O(log n) steps instead of a walk over the whole list.
+ *
+ * The index nodes come from a static pool of SKIP_LIST_POOL_SIZE nodes shared by all indexes. If
+ * the pool cannot hold a full index the stride is raised until it fits, so an index can always be
+ * built but gets slower when the pool is small compared to the list.
+ *
+ * An index is only valid as long as its list does not change. After adding, removing or sorting
+ * items, clear it with SkipListClear() and build it again.
+ */
+
+#include "LinkedList.h"
+
+/**
+ * The number of index nodes available to all skip lists together. An index over n items needs
+ * about n nodes with a stride of 2, n / 2 nodes with a stride of 4 and so on.
+ */
+#ifndef SKIP_LIST_POOL_SIZE
+#define SKIP_LIST_POOL_SIZE 64
+#endif
+
+/**
+ * One node of the index. rank is the position of item in the list, counting the head as 0.
+ */
+typedef struct SkipListNode {
+	ListItem *item;
+	struct SkipListNode *next;
+	struct SkipListNode *down;
+	int rank;
+} SkipListNode;
+
+/**
+ * A skip-list index over one sorted list. top is the first node of the highest level, which always
+ * points at the head of the list, like the first node of every other level.
+ */
+typedef struct SkipList {
+	SkipListNode *top;
+	ListItem *head;
+	int size;
+	int stride;
+} SkipList;
+
+/**
+ * SkipListBuild() builds an index over the list that list belongs to. The list must be sorted with
+ * LinkedListSort() or kept sorted with LinkedListInsertSorted(). It takes one pass over the list.
+ * The stride is the smallest power of two for which the whole index fits into the nodes left in
+ * the pool. Should the pool run out anyway, whatever was built is given back and lookups walk the
+ * list from its head.
+ *
+ * @param index Where to build the index. Any index built here before must have been cleared.
+ * @param list Any element of the sorted list. May be NULL for an empty list.
+ * @return SUCCESS or STANDARD_ERROR if index is NULL.
+ */
+int SkipListBuild(SkipList *index, ListItem *list);
+
+/**
+ * SkipListClear() gives the nodes of index back to the pool and leaves it empty.
+ *
+ * @param index The index to clear.
+ */
+void SkipListClear(SkipList *index);
+
+/**
+ * SkipListLowerBound() finds the first ListItem that does not sort before word.
+ *
+ * @param index The index to search.
+ * @param word The word to look for. May be NULL.
+ * @return The first ListItem comparing greater than or equal to word, or NULL if there is none.
+ */
+ListItem *SkipListLowerBound(const SkipList *index, char *word);
+
+/**
+ * SkipListFind() finds the first ListItem holding word.
+ *
+ * @param index The index to search.
+ * @param word The word to look for. May be NULL.
+ * @return The first ListItem equal to word, or NULL if word is not in the list.
+ */
+ListItem *SkipListFind(const SkipList *index, char *word);
+
+/**
+ * SkipListCount() counts how many times word occurs in the list, with two O(log n) searches.
+ *
+ * @param index The index to search.
+ * @param word The word to count. May be NULL.
+ * @return The number of ListItems equal to word.
+ */
+int SkipListCount(const SkipList *index, char *word);
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * @file
+ * This file provides interrupt-driven transmission on the UART that BOARD_Init() sets up for stdio
+ * (UART_USED). Text handed to UartQueueWrite() is copied into a circular buffer and sent by the
+ * UART interrupt in the background, so the caller never waits for the serial line.
+ */
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// Microchip libraries
+#include <xc.h>
+#include <plib.h>
+#include <sys/attribs.h>
+
+// User libraries
+#include "UartQueue.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define UART_QUEUE_TX_INT INT_SOURCE_UART_TX(UART_USED)
+#define UART_QUEUE_RX_INT INT_SOURCE_UART_RX(UART_USED)
+
+// The interrupt vector of UART_USED. UART_USED names an enum constant, which #if cannot compare,
+// so the vector is looked up by pasting its name; any other UART fails to compile right here.
+#define UART_QUEUE_VECTOR_UART1 _UART_1_VECTOR
+#define UART_QUEUE_VECTOR_UART2 _UART_2_VECTOR
+#define UART_QUEUE_VECTOR_OF(uart) UART_QUEUE_VECTOR_ ## uart
+#define UART_QUEUE_VECTOR(uart) UART_QUEUE_VECTOR_OF(uart)
+
+// **** Define any module-level, global, or external variables here ****
+// The transmit buffer. head is only written by UartQueueWrite() and tail only by the interrupt, and
+// one byte is always left unused so that head == tail means empty.
+static char txBuffer[UART_QUEUE_TX_SIZE];
+static volatile int txHead = 0;
+static volatile int txTail = 0;
+// Called by the interrupt with every received byte, see UartQueueSetRxHandler().
+static volatile UartQueueRxHandler rxHandler = NULL;
+
+/**
+ * UartQueueInit() sets up the UART interrupt and empties the transmit buffer. It must be called
+ * after BOARD_Init() and before any other function in this file.
+ */
+void UartQueueInit(void)
+{
+    INTEnable(UART_QUEUE_TX_INT, INT_DISABLED);
+    INTEnable(UART_QUEUE_RX_INT, INT_DISABLED);
+    txHead = 0;
+    txTail = 0;
+    rxHandler = NULL;
+    INTSetVectorPriority(INT_VECTOR_UART(UART_USED), INT_PRIORITY_LEVEL_4);
+    INTSetVectorSubPriority(INT_VECTOR_UART(UART_USED), INT_SUB_PRIORITY_LEVEL_0);
+    INTClearFlag(UART_QUEUE_TX_INT);
+    INTClearFlag(UART_QUEUE_RX_INT);
+}
+
+/**
+ * UartQueueWrite() queues up to length bytes of data for transmission and returns immediately. If
+ * the buffer does not have room for all of them only the ones that fit are queued.
+ *
+ * @param data The bytes to send.
+ * @param length The number of bytes in data.
+ * @return The number of bytes that were queued.
+ */
+int UartQueueWrite(const char *data, int length)
+{
+    int space = UartQueueFree();
+    int head = txHead;
+    int i;
+
+    if (length > space) {
+        length = space;
+    }
+    for (i = 0; i < length; i++) {
+        txBuffer[head] = data[i];
+        head = (head + 1) % UART_QUEUE_TX_SIZE;
+    }
+    txHead = head;
+    // The interrupt fires as long as the UART has room, and turns itself off once txBuffer is empty.
+    if (length > 0) {
+        INTEnable(UART_QUEUE_TX_INT, INT_ENABLED);
+    }
+    return length;
+}
+
+/**
+ * UartQueueFree() returns how many more bytes UartQueueWrite() can currently accept.
+ *
+ * @return The number of free bytes in the transmit buffer.
+ */
+int UartQueueFree(void)
+{
+    return (txTail - txHead - 1 + UART_QUEUE_TX_SIZE) % UART_QUEUE_TX_SIZE;
+}
+
+/**
+ * UartQueueIdle() checks whether everything queued so far has been handed to the UART.
+ *
+ * @return TRUE if the transmit buffer is empty, FALSE otherwise.
+ */
+int UartQueueIdle(void)
+{
+    return txHead == txTail;
+}
+
+/**
+ * UartQueueSetRxHandler() has the UART interrupt call handler with every byte received, in the
+ * order they arrive, and turns the receive interrupt on. handler runs in interrupt context, so it
+ * should be short and only touch volatile state. While a handler is installed, received bytes no
+ * longer reach getchar() and scanf().
+ *
+ * @param handler The function to call, or NULL to turn the receive interrupt off again.
+ */
+void UartQueueSetRxHandler(UartQueueRxHandler handler)
+{
+    INTEnable(UART_QUEUE_RX_INT, INT_DISABLED);
+    rxHandler = handler;
+    if (handler != NULL) {
+        INTClearFlag(UART_QUEUE_RX_INT);
+        INTEnable(UART_QUEUE_RX_INT, INT_ENABLED);
+    }
+}
+
+/**
+ * The UART interrupt moves bytes from txBuffer into the UART's hardware FIFO until one of them is
+ * full or empty, and passes received bytes on to rxHandler.
+ */
+void __ISR(UART_QUEUE_VECTOR(UART_USED), IPL4AUTO) UartQueueIntHandler(void)
+{
+    if (INTGetFlag(UART_QUEUE_TX_INT)) {
+        while (txTail != txHead && UARTTransmitterIsReady(UART_USED)) {
+            UARTSendDataByte(UART_USED, txBuffer[txTail]);
+            txTail = (txTail + 1) % UART_QUEUE_TX_SIZE;
+        }
+        if (txTail == txHead) {
+            INTEnable(UART_QUEUE_TX_INT, INT_DISABLED);
+        }
+        INTClearFlag(UART_QUEUE_TX_INT);
+    }
+    if (INTGetFlag(UART_QUEUE_RX_INT)) {
+        while (UARTReceivedDataIsAvailable(UART_USED)) {
+            char byte = UARTGetDataByte(UART_USED);
+            if (rxHandler != NULL) {
+                rxHandler(byte);
+            }
+        }
+        INTClearFlag(UART_QUEUE_RX_INT);
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef UARTQUEUE_H
+#define UARTQUEUE_H
+
+/**
+ * @file
+ * This file provides interrupt-driven transmission on the UART that BOARD_Init() sets up for stdio
+ * (UART_USED). Text handed to UartQueueWrite() is copied into a circular buffer and sent by the
+ * UART interrupt in the background, so the caller never waits for the serial line. Anything printed
+ * with printf() at the same time goes straight to the UART and can end up interleaved with queued
+ * text, so wait for UartQueueIdle() before switching back to printf().
+ *
+ * The same interrupt can also hand every received byte to a handler, see UartQueueSetRxHandler().
+ */
+
+/**
+ * The size of the transmit buffer in bytes. At 115200 baud this is about 22ms worth of output.
+ */
+#ifndef UART_QUEUE_TX_SIZE
+#define UART_QUEUE_TX_SIZE 256
+#endif
+
+/**
+ * The type of the function UartQueueSetRxHandler() installs. It runs in interrupt context.
+ */
+typedef void (*UartQueueRxHandler)(char byte);
+
+/**
+ * UartQueueInit() sets up the UART interrupt and empties the transmit buffer. It must be called
+ * after BOARD_Init() and before any other function in this file.
+ */
+void UartQueueInit(void);
+
+/**
+ * UartQueueWrite() queues up to length bytes of data for transmission and returns immediately. If
+ * the buffer does not have room for all of them only the ones that fit are queued.
+ *
+ * @param data The bytes to send.
+ * @param length The number of bytes in data.
+ * @return The number of bytes that were queued.
+ */
+int UartQueueWrite(const char *data, int length);
+
+/**
+ * UartQueueFree() returns how many more bytes UartQueueWrite() can currently accept.
+ *
+ * @return The number of free bytes in the transmit buffer.
+ */
+int UartQueueFree(void);
+
+/**
+ * UartQueueIdle() checks whether everything queued so far has been handed to the UART.
+ *
+ * @return TRUE if the transmit buffer is empty, FALSE otherwise.
+ */
+int UartQueueIdle(void);
+
+/**
+ * UartQueueSetRxHandler() has the UART interrupt call handler with every byte received, in the
+ * order they arrive, and turns the receive interrupt on. handler runs in interrupt context, so it
+ * should be short and only touch volatile state. While a handler is installed, received bytes no
+ * longer reach getchar() and scanf().
+ *
+ * @param handler The function to call, or NULL to turn the receive interrupt off again.
+ */
+void UartQueueSetRxHandler(UartQueueRxHandler handler);
+
+#endif
@@ -0,0 +1,290 @@
+/**
+ * @file
+ * This file provides an unrolled linked list of strings. Every node holds up to
+ * UNROLLED_LIST_NODE_CAPACITY data pointers plus a fill count, so the link overhead and the
+ * pointer chasing are shared by a whole node's worth of words.
+ */
+
+//Standard Libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "UnrolledList.h"
+
+/**
+ * UnrolledListNewNode() allocates an empty node and links it into list after the node after, or
+ * at the head if after is NULL.
+ */
+static UnrolledNode *UnrolledListNewNode(UnrolledList *list, UnrolledNode *after)
+{
+    UnrolledNode *node = malloc(sizeof (UnrolledNode));
+    if (node == NULL) {
+        return NULL;
+    }
+    node->count = 0;
+    node->previous = after;
+    node->next = (after == NULL) ? list->head : after->next;
+    if (node->next != NULL) {
+        node->next->previous = node;
+    } else {
+        list->tail = node;
+    }
+    if (after != NULL) {
+        after->next = node;
+    } else {
+        list->head = node;
+    }
+    return node;
+}
+
+/**
+ * UnrolledListFreeNode() unlinks node from list and frees it.
+ */
+static void UnrolledListFreeNode(UnrolledList *list, UnrolledNode *node)
+{
+    if (node->previous != NULL) {
+        node->previous->next = node->next;
+    } else {
+        list->head = node->next;
+    }
+    if (node->next != NULL) {
+        node->next->previous = node->previous;
+    } else {
+        list->tail = node->previous;
+    }
+    free(node);
+}
+
+/**
+ * UnrolledListInit() sets up list as an empty list.
+ *
+ * @param list The list to initialize.
+ */
+void UnrolledListInit(UnrolledList *list)
+{
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+
+/**
+ * UnrolledListAppend() adds data at the end of list.
+ *
+ * @param list The list to add to.
+ * @param data The string to add. May be NULL.
+ * @return SUCCESS or STANDARD_ERROR if a new node could not be allocated.
+ */
+int UnrolledListAppend(UnrolledList *list, char *data)
+{
+    UnrolledNode *node = list->tail;
+    if (node == NULL || node->count == UNROLLED_LIST_NODE_CAPACITY) {
+        node = UnrolledListNewNode(list, node);
+        if (node == NULL) {
+            return STANDARD_ERROR;
+        }
+    }
+    node->data[node->count++] = data;
+    list->size++;
+    return SUCCESS;
+}
+
+/**
+ * UnrolledListInsertAfter() adds data right after the position of it, which then moves to the new
+ * element. A full node is split in half to make room. If it is past the end, data is appended.
+ *
+ * @param list The list to add to.
+ * @param it The position to add after.
+ * @param data The string to add. May be NULL.
+ * @return SUCCESS or STANDARD_ERROR if a new node could not be allocated.
+ */
+int UnrolledListInsertAfter(UnrolledList *list, UnrolledListIterator *it, char *data)
+{
+    UnrolledNode *node = it->node;
+    if (node == NULL) {
+        if (UnrolledListAppend(list, data) != SUCCESS) {
+            return STANDARD_ERROR;
+        }
+        it->node = list->tail;
+        it->index = list->tail->count - 1;
+        return SUCCESS;
+    }
+
+    int index = it->index + 1;
+    if (node->count == UNROLLED_LIST_NODE_CAPACITY) {
+        // Move the upper half into a new node and insert into whichever half index falls in.
+        UnrolledNode *upper = UnrolledListNewNode(list, node);
+        if (upper == NULL) {
+            return STANDARD_ERROR;
+        }
+        int half = UNROLLED_LIST_NODE_CAPACITY / 2;
+        upper->count = node->count - half;
+        memcpy(upper->data, &node->data[half], upper->count * sizeof (char *));
+        node->count = half;
+        if (index > half) {
+            node = upper;
+            index -= half;
+        }
+    }
+    memmove(&node->data[index + 1], &node->data[index], (node->count - index) * sizeof (char *));
+    node->data[index] = data;
+    node->count++;
+    list->size++;
+    it->node = node;
+    it->index = index;
+    return SUCCESS;
+}
+
+/**
+ * UnrolledListRemove() removes the element at the position of it, which then moves to the element
+ * after it. The string itself is not freed.
+ *
+ * @param list The list to remove from.
+ * @param it The position to remove. Must not be past the end.
+ * @return The data of the removed element, or NULL if it was past the end.
+ */
+char *UnrolledListRemove(UnrolledList *list, UnrolledListIterator *it)
+{
+    UnrolledNode *node = it->node;
+    if (node == NULL) {
+        return NULL;
+    }
+    char *data = node->data[it->index];
+    node->count--;
+    memmove(&node->data[it->index], &node->data[it->index + 1],
+            (node->count - it->index) * sizeof (char *));
+    list->size--;
+
+    if (node->count == 0) {
+        it->node = node->next;
+        it->index = 0;
+        UnrolledListFreeNode(list, node);
+        return data;
+    }
+    // Pull in the next node if this one got less than half full and both fit in one.
+    UnrolledNode *next = node->next;
+    if (next != NULL && node->count < UNROLLED_LIST_NODE_CAPACITY / 2 &&
+            node->count + next->count <= UNROLLED_LIST_NODE_CAPACITY) {
+        memcpy(&node->data[node->count], next->data, next->count * sizeof (char *));
+        node->count += next->count;
+        UnrolledListFreeNode(list, next);
+    }
+    if (it->index == node->count) {
+        it->node = node->next;
+        it->index = 0;
+    }
+    return data;
+}
+
+/**
+ * UnrolledListFree() frees every node of list and leaves it empty. The strings are not freed.
+ *
+ * @param list The list to free.
+ */
+void UnrolledListFree(UnrolledList *list)
+{
+    UnrolledNode *node, *next;
+    for (node = list->head; node != NULL; node = next) {
+        next = node->next;
+        free(node);
+    }
+    UnrolledListInit(list);
+}
+
+/**
+ * UnrolledListSize() returns the number of strings in list. This is O(1).
+ *
+ * @param list The list.
+ * @return The number of strings, 0 if list is NULL.
+ */
+int UnrolledListSize(const UnrolledList *list)
+{
+    return (list == NULL) ? 0 : list->size;
+}
+
+/**
+ * UnrolledListFirst() moves it to the first element of list.
+ *
+ * @param list The list.
+ * @param it The iterator to set.
+ * @return TRUE if list has a first element, FALSE if it is empty.
+ */
+int UnrolledListFirst(const UnrolledList *list, UnrolledListIterator *it)
+{
+    it->node = list->head;
+    it->index = 0;
+    return it->node != NULL;
+}
+
+/**
+ * UnrolledListNext() moves it to the next element.
+ *
+ * @param it The iterator to advance.
+ * @return TRUE if there was a next element, FALSE if it is now past the end.
+ */
+int UnrolledListNext(UnrolledListIterator *it)
+{
+    if (it->node == NULL) {
+        return FALSE;
+    }
+    if (++it->index == it->node->count) {
+        it->node = it->node->next;
+        it->index = 0;
+    }
+    return it->node != NULL;
+}
+
+/**
+ * UnrolledListValid() checks whether it is at an element rather than past the end.
+ *
+ * @param it The iterator.
+ * @return TRUE or FALSE.
+ */
+int UnrolledListValid(const UnrolledListIterator *it)
+{
+    return it->node != NULL;
+}
+
+/**
+ * UnrolledListData() returns the string at the position of it.
+ *
+ * @param it The iterator. Must not be past the end.
+ * @return The data pointer stored there.
+ */
+char *UnrolledListData(const UnrolledListIterator *it)
+{
+    return it->node->data[it->index];
+}
+
+/**
+ * UnrolledListPrint() prints list to stdout in the same format as LinkedListPrint().
+ *
+ * @param list The list to print.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL.
+ */
+int UnrolledListPrint(const UnrolledList *list)
+{
+    const UnrolledNode *node;
+    int i;
+    if (list == NULL) {
+        return STANDARD_ERROR;
+    }
+    fputs("{", stdout);
+    for (node = list->head; node != NULL; node = node->next) {
+        for (i = 0; i < node->count; i++) {
+            if (node->data[i] == NULL) {
+                fputs("-(null)-", stdout);
+            } else {
+                fputs("-", stdout);
+                fputs(node->data[i], stdout);
+                fputs("-", stdout);
+            }
+        }
+    }
+    fputs("}\n", stdout);
+    return SUCCESS;
+}
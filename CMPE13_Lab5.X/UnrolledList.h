@@ -0,0 +1,150 @@
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+
+/**
+ * @file
+ * This file provides an unrolled linked list of strings. Every node holds up to
+ * UNROLLED_LIST_NODE_CAPACITY data pointers plus a fill count, so the two link pointers and the
+ * malloc() header are shared by a whole node's worth of words instead of being paid for each word,
+ * and walking the list follows one pointer per node instead of one per word. Inserting and
+ * removing only shifts the pointers within one node and stays O(1) for a given position.
+ *
+ * Positions in the list are UnrolledListIterators. Iterating looks like this:
+ *
+ *     UnrolledListIterator it;
+ *     for (UnrolledListFirst(&list, &it); UnrolledListValid(&it); UnrolledListNext(&it)) {
+ *         char *word = UnrolledListData(&it);
+ *     }
+ *
+ * Any insert or remove invalidates every iterator except the one passed to it.
+ */
+
+/**
+ * How many data pointers one node holds. Nodes that drop to half of this are merged with their
+ * successor when possible, so the list stays at least about half full.
+ */
+#ifndef UNROLLED_LIST_NODE_CAPACITY
+#define UNROLLED_LIST_NODE_CAPACITY 12
+#endif
+
+/**
+ * One node of an unrolled list. data[0] to data[count - 1] are in use.
+ */
+typedef struct UnrolledNode {
+	struct UnrolledNode *previous;
+	struct UnrolledNode *next;
+	int count;
+	char *data[UNROLLED_LIST_NODE_CAPACITY];
+} UnrolledNode;
+
+/**
+ * An unrolled list. size is the number of strings, not nodes.
+ */
+typedef struct UnrolledList {
+	UnrolledNode *head;
+	UnrolledNode *tail;
+	int size;
+} UnrolledList;
+
+/**
+ * A position in an unrolled list. It is past the end of the list once node is NULL.
+ */
+typedef struct UnrolledListIterator {
+	UnrolledNode *node;
+	int index;
+} UnrolledListIterator;
+
+/**
+ * UnrolledListInit() sets up list as an empty list.
+ *
+ * @param list The list to initialize.
+ */
+void UnrolledListInit(UnrolledList *list);
+
+/**
+ * UnrolledListAppend() adds data at the end of list.
+ *
+ * @param list The list to add to.
+ * @param data The string to add. May be NULL.
+ * @return SUCCESS or STANDARD_ERROR if a new node could not be allocated.
+ */
+int UnrolledListAppend(UnrolledList *list, char *data);
+
+/**
+ * UnrolledListInsertAfter() adds data right after the position of it, which then moves to the new
+ * element. A full node is split in half to make room. If it is past the end, data is appended.
+ *
+ * @param list The list to add to.
+ * @param it The position to add after.
+ * @param data The string to add. May be NULL.
+ * @return SUCCESS or STANDARD_ERROR if a new node could not be allocated.
+ */
+int UnrolledListInsertAfter(UnrolledList *list, UnrolledListIterator *it, char *data);
+
+/**
+ * UnrolledListRemove() removes the element at the position of it, which then moves to the element
+ * after it. The string itself is not freed.
+ *
+ * @param list The list to remove from.
+ * @param it The position to remove. Must not be past the end.
+ * @return The data of the removed element, or NULL if it was past the end.
+ */
+char *UnrolledListRemove(UnrolledList *list, UnrolledListIterator *it);
+
+/**
+ * UnrolledListFree() frees every node of list and leaves it empty. The strings are not freed.
+ *
+ * @param list The list to free.
+ */
+void UnrolledListFree(UnrolledList *list);
+
+/**
+ * UnrolledListSize() returns the number of strings in list. This is O(1).
+ *
+ * @param list The list.
+ * @return The number of strings, 0 if list is NULL.
+ */
+int UnrolledListSize(const UnrolledList *list);
+
+/**
+ * UnrolledListFirst() moves it to the first element of list.
+ *
+ * @param list The list.
+ * @param it The iterator to set.
+ * @return TRUE if list has a first element, FALSE if it is empty.
+ */
+int UnrolledListFirst(const UnrolledList *list, UnrolledListIterator *it);
+
+/**
+ * UnrolledListNext() moves it to the next element.
+ *
+ * @param it The iterator to advance.
+ * @return TRUE if there was a next element, FALSE if it is now past the end.
+ */
+int UnrolledListNext(UnrolledListIterator *it);
+
+/**
+ * UnrolledListValid() checks whether it is at an element rather than past the end.
+ *
+ * @param it The iterator.
+ * @return TRUE or FALSE.
+ */
+int UnrolledListValid(const UnrolledListIterator *it);
+
+/**
+ * UnrolledListData() returns the string at the position of it.
+ *
+ * @param it The iterator. Must not be past the end.
+ * @return The data pointer stored there.
+ */
+char *UnrolledListData(const UnrolledListIterator *it);
+
+/**
+ * UnrolledListPrint() prints list to stdout in the same format as LinkedListPrint().
+ *
+ * @param list The list to print.
+ * @return SUCCESS or STANDARD_ERROR if list is NULL.
+ */
+int UnrolledListPrint(const UnrolledList *list);
+
+#endif
@@ -0,0 +1,169 @@
+/**
+ * @file
+ * This file provides streaming word input over the UART. Received bytes are stored by the UART
+ * interrupt in a ring buffer and split into words in place, with ListItems pointing straight into
+ * the buffer.
+ */
+
+//Standard Libraries
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "UartQueue.h"
+#include "WordStream.h"
+
+// **** Define any module-level, global, or external variables here ****
+// The ring, followed by the spare area that the wrapped part of a word is copied to. The interrupt
+// writes at rxHead and never reaches rxRelease, the start of the oldest word not released yet.
+// Everything from scan to rxHead has not been looked at; a word in progress starts at wordStart.
+// A word that grew too long is dropped right away and the rest of it skipped, see WordStreamPoll().
+static char rxBuffer[WORD_STREAM_BUFFER_SIZE + WORD_STREAM_MAX_WORD_LENGTH + 1];
+static volatile int rxHead = 0;
+static volatile int rxRelease = 0;
+static volatile int droppedBytes = 0;
+static int scan = 0;
+static int wordStart = -1;
+static int wordLength = 0;
+static int droppedWords = 0;
+static int skipping = FALSE;
+static int paused = FALSE;
+static int outOfItems = FALSE;
+
+/**
+ * WordStreamReceive() is the UART receive handler. It runs in interrupt context.
+ */
+static void WordStreamReceive(char byte)
+{
+    int next = (rxHead + 1) % WORD_STREAM_BUFFER_SIZE;
+    if (next == rxRelease) {
+        droppedBytes++;
+        return;
+    }
+    rxBuffer[rxHead] = byte;
+    rxHead = next;
+}
+
+/**
+ * WordStreamFlowControl() sends XOFF or XON when the state of the ring or the ListItem supply
+ * calls for it. A control character that does not fit into the transmit queue is retried next time.
+ */
+static void WordStreamFlowControl(void)
+{
+    int used = (rxHead - rxRelease + WORD_STREAM_BUFFER_SIZE) % WORD_STREAM_BUFFER_SIZE;
+    int room = WORD_STREAM_BUFFER_SIZE - 1 - used;
+    char control;
+
+    if (!paused && (outOfItems || room < WORD_STREAM_XOFF_LEVEL)) {
+        control = WORD_STREAM_XOFF;
+        paused = (UartQueueWrite(&control, 1) == 1);
+    } else if (paused && !outOfItems && room >= 2 * WORD_STREAM_XOFF_LEVEL) {
+        control = WORD_STREAM_XON;
+        paused = (UartQueueWrite(&control, 1) != 1);
+    }
+}
+
+/**
+ * WordStreamInit() empties the ring and starts receiving by installing the UART receive handler.
+ * UartQueueInit() must have been called first.
+ */
+void WordStreamInit(void)
+{
+    UartQueueSetRxHandler(NULL);
+    rxHead = 0;
+    rxRelease = 0;
+    droppedBytes = 0;
+    scan = 0;
+    wordStart = -1;
+    wordLength = 0;
+    droppedWords = 0;
+    skipping = FALSE;
+    paused = FALSE;
+    outOfItems = FALSE;
+    UartQueueSetRxHandler(WordStreamReceive);
+}
+
+/**
+ * WordStreamPoll() appends a ListItem to list for every complete word received since the last
+ * call. A word is complete once the whitespace after it has arrived. Call it often enough that
+ * the ring does not fill up; it never blocks.
+ *
+ * @param list The list to append the words to.
+ * @return The number of words appended.
+ */
+int WordStreamPoll(LinkedList *list)
+{
+    int head = rxHead;
+    int words = 0;
+    char byte, *word;
+
+    outOfItems = FALSE;
+    while (scan != head) {
+        byte = rxBuffer[scan];
+        if (!isspace((unsigned char) byte)) {
+            if (skipping) {
+                // Still inside a dropped word.
+            } else if (wordStart < 0) {
+                wordStart = scan;
+                wordLength = 1;
+            } else if (++wordLength > WORD_STREAM_MAX_WORD_LENGTH) {
+                // Drop the word now so that WordStreamRelease() can free the ring behind it.
+                droppedWords++;
+                wordStart = -1;
+                skipping = TRUE;
+            }
+            scan = (scan + 1) % WORD_STREAM_BUFFER_SIZE;
+            continue;
+        }
+        skipping = FALSE;
+        if (wordStart >= 0) {
+            // Terminate the word in place, or after its wrapped part moved to the spare area.
+            word = &rxBuffer[wordStart];
+            if (wordStart + wordLength > WORD_STREAM_BUFFER_SIZE) {
+                memcpy(&rxBuffer[WORD_STREAM_BUFFER_SIZE], rxBuffer, scan);
+                rxBuffer[WORD_STREAM_BUFFER_SIZE + scan] = '\0';
+            } else if (wordStart + wordLength == WORD_STREAM_BUFFER_SIZE) {
+                rxBuffer[WORD_STREAM_BUFFER_SIZE] = '\0';
+            } else {
+                rxBuffer[scan] = '\0';
+            }
+            if (LinkedListAppend(list, word) == NULL) {
+                // Put the whitespace back and try this word again next time.
+                rxBuffer[scan] = byte;
+                outOfItems = TRUE;
+                break;
+            }
+            words++;
+        }
+        wordStart = -1;
+        scan = (scan + 1) % WORD_STREAM_BUFFER_SIZE;
+    }
+    WordStreamFlowControl();
+    return words;
+}
+
+/**
+ * WordStreamRelease() gives the space of every word WordStreamPoll() has returned back to the ring.
+ * Every ListItem pointing at those words must have been freed or stopped being used.
+ */
+void WordStreamRelease(void)
+{
+    rxRelease = (wordStart >= 0) ? wordStart : scan;
+    WordStreamFlowControl();
+}
+
+/**
+ * WordStreamDropped() returns how many bytes were dropped because the ring was full, plus the
+ * number of words dropped for being longer than WORD_STREAM_MAX_WORD_LENGTH.
+ *
+ * @return The number of dropped bytes and words so far.
+ */
+int WordStreamDropped(void)
+{
+    return droppedBytes + droppedWords;
+}
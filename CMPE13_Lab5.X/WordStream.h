@@ -0,0 +1,85 @@
+#ifndef WORDSTREAM_H
+#define WORDSTREAM_H
+
+/**
+ * @file
+ * This file provides streaming word input over the UART. Received bytes are stored by the UART
+ * interrupt in a ring buffer, and WordStreamPoll() splits them into words at whitespace right
+ * where they sit: the character after every word is overwritten with the terminating zero and the
+ * ListItem appended for the word points straight into the buffer. No word is ever copied to the
+ * heap, except that a word that wraps around the end of the ring gets its wrapped part copied to a
+ * small spare area right after the ring so it can be read in one piece.
+ *
+ * Words stay in the buffer until WordStreamRelease(), so a typical loop reads a batch of words with
+ * WordStreamPoll(), processes and frees their ListItems and then releases the batch. WordStream
+ * asks the sender to pause with XOFF when the ring gets close to full or no more ListItems can be
+ * allocated (for example because the LINKED_LIST_POOL_SIZE pool is empty) and to continue with XON
+ * once there is room again. Bytes that arrive while the ring is full anyway are dropped and
+ * counted.
+ *
+ * With LINKED_LIST_INTERN defined, interned strings point into the buffer too, so call
+ * LinkedListInternReset() before WordStreamRelease().
+ */
+
+#include "LinkedList.h"
+
+/**
+ * The size of the receive ring in bytes.
+ */
+#ifndef WORD_STREAM_BUFFER_SIZE
+#define WORD_STREAM_BUFFER_SIZE 256
+#endif
+
+/**
+ * The longest word WordStream passes on. Longer words are dropped as soon as they grow past this,
+ * and the rest of them is skipped without taking up the ring.
+ */
+#ifndef WORD_STREAM_MAX_WORD_LENGTH
+#define WORD_STREAM_MAX_WORD_LENGTH 31
+#endif
+
+/**
+ * XOFF is sent once fewer than this many bytes of the ring are free, and XON once at least twice
+ * as many are free again. At 115200 baud 32 bytes give the sender about 2.8ms to react.
+ */
+#ifndef WORD_STREAM_XOFF_LEVEL
+#define WORD_STREAM_XOFF_LEVEL 32
+#endif
+
+/**
+ * The software flow control characters.
+ */
+#define WORD_STREAM_XON 0x11
+#define WORD_STREAM_XOFF 0x13
+
+/**
+ * WordStreamInit() empties the ring and starts receiving by installing the UART receive handler.
+ * UartQueueInit() must have been called first.
+ */
+void WordStreamInit(void);
+
+/**
+ * WordStreamPoll() appends a ListItem to list for every complete word received since the last
+ * call. A word is complete once the whitespace after it has arrived. Call it often enough that
+ * the ring does not fill up; it never blocks.
+ *
+ * @param list The list to append the words to.
+ * @return The number of words appended.
+ */
+int WordStreamPoll(LinkedList *list);
+
+/**
+ * WordStreamRelease() gives the space of every word WordStreamPoll() has returned back to the ring.
+ * Every ListItem pointing at those words must have been freed or stopped being used.
+ */
+void WordStreamRelease(void);
+
+/**
+ * WordStreamDropped() returns how many bytes were dropped because the ring was full, plus the
+ * number of words dropped for being longer than WORD_STREAM_MAX_WORD_LENGTH.
+ *
+ * @return The number of dropped bytes and words so far.
+ */
+int WordStreamDropped(void);
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file
+ * This file provides a small hash table keyed on strings for counting and looking up words. It uses
+ * open addressing with linear probing over a fixed array of WORD_TABLE_CAPACITY entries, so a table
+ * never touches the heap and can be declared static wherever it is needed.
+ */
+
+//Standard Libraries
+#include <stdio.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "WordTable.h"
+#include "FastString.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define WORD_TABLE_MASK (WORD_TABLE_CAPACITY - 1)
+#define WORD_TABLE_LIMIT (WORD_TABLE_CAPACITY - WORD_TABLE_CAPACITY / 4)
+
+// **** Define any module-level, global, or external variables here ****
+// Zero-initialised, so empty without a WordTableClear(), see WordTable.h.
+WordTable wordTableScratch;
+
+/**
+ * WordTableClear() empties table. It must be called before a table is used the first time.
+ *
+ * @param table The table to empty.
+ */
+void WordTableClear(WordTable *table)
+{
+    int i;
+    for (i = 0; i < WORD_TABLE_CAPACITY; i++) {
+        table->entries[i].word = NULL;
+    }
+    table->used = 0;
+}
+
+/**
+ * WordTableHash() returns the 32-bit FNV-1a hash of the first length bytes of word.
+ *
+ * @param word The string to hash.
+ * @param length The number of bytes of word to hash.
+ * @return The hash value.
+ */
+uint32_t WordTableHash(const char *word, unsigned int length)
+{
+    uint32_t hash = 2166136261u;
+    unsigned int i;
+    for (i = 0; i < length; i++) {
+        hash ^= (unsigned char) word[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * WordTableLookup() finds the entry for word in table. If word is not in the table yet and insert
+ * is TRUE a new entry is created for it, otherwise NULL is returned. Insertion also fails, returning
+ * NULL, once the table is three quarters full.
+ *
+ * @param table The table to search.
+ * @param word The word to look up. Must not be NULL.
+ * @param length The length of word, as returned by strlen().
+ * @param insert Whether to create an entry when word is missing.
+ * @return The entry for word or NULL.
+ */
+WordTableEntry *WordTableLookup(WordTable *table, const char *word, unsigned int length, int insert)
+{
+    uint32_t hash = WordTableHash(word, length);
+    unsigned int slot = hash & WORD_TABLE_MASK;
+    WordTableEntry *entry;
+
+    // The table is never allowed to fill up completely, so this always reaches an empty slot.
+    while ((entry = &table->entries[slot])->word != NULL) {
+        if (entry->hash == hash && entry->length == length &&
+                FastStringCompare(entry->word, word, length) == 0) {
+            return entry;
+        }
+        slot = (slot + 1) & WORD_TABLE_MASK;
+    }
+    if (!insert || table->used >= WORD_TABLE_LIMIT) {
+        return NULL;
+    }
+    entry->word = word;
+    entry->length = length;
+    entry->hash = hash;
+    entry->id = ++table->used;
+    entry->count = 0;
+    entry->first = -1;
+    entry->firstItem = NULL;
+    return entry;
+}
@@ -0,0 +1,83 @@
+#ifndef WORDTABLE_H
+#define WORDTABLE_H
+
+/**
+ * @file
+ * This file provides a small hash table keyed on strings for counting and looking up words. It uses
+ * open addressing with linear probing over a fixed array of WORD_TABLE_CAPACITY entries, so a table
+ * never touches the heap and can be declared static wherever it is needed. Like the ListItems, the
+ * table only points at strings, the strings themselves must be stored somewhere else.
+ */
+
+#include <stdint.h>
+
+/**
+ * The number of entries in every WordTable. This must be a power of two. A table holds at most
+ * three quarters of this many distinct words so that probe sequences stay short.
+ */
+#ifndef WORD_TABLE_CAPACITY
+#define WORD_TABLE_CAPACITY 64
+#endif
+
+/**
+ * One slot of a WordTable. A slot with a NULL word is empty. Every word gets an id when it is
+ * inserted, counting up from 1 in insertion order. count, first and firstItem are not used by
+ * the table itself, they are free for the caller, and are set to 0, -1 and NULL when a word is
+ * inserted.
+ */
+typedef struct WordTableEntry {
+	const char *word;
+	unsigned int length;
+	uint32_t hash;
+	unsigned int id;
+	int count;
+	int first;
+	const void *firstItem;
+} WordTableEntry;
+
+/**
+ * A fixed-capacity hash table of words.
+ */
+typedef struct WordTable {
+	WordTableEntry entries[WORD_TABLE_CAPACITY];
+	int used;
+} WordTable;
+
+/**
+ * A WordTable for functions that only need one for the length of a call, such as
+ * UnsortedWordCountHashed() in sort.c and LinkedListTopK(), so that they share its memory instead
+ * of each keeping their own. It starts out empty, and every user must leave it empty again before
+ * returning, which is cheapest by emptying only the slots it used.
+ */
+extern WordTable wordTableScratch;
+
+/**
+ * WordTableClear() empties table. It must be called before a table is used the first time.
+ *
+ * @param table The table to empty.
+ */
+void WordTableClear(WordTable *table);
+
+/**
+ * WordTableHash() returns the 32-bit FNV-1a hash of the first length bytes of word.
+ *
+ * @param word The string to hash.
+ * @param length The number of bytes of word to hash.
+ * @return The hash value.
+ */
+uint32_t WordTableHash(const char *word, unsigned int length);
+
+/**
+ * WordTableLookup() finds the entry for word in table. If word is not in the table yet and insert
+ * is TRUE a new entry is created for it, otherwise NULL is returned. Insertion also fails, returning
+ * NULL, once the table is three quarters full.
+ *
+ * @param table The table to search.
+ * @param word The word to look up. Must not be NULL.
+ * @param length The length of word, as returned by strlen().
+ * @param insert Whether to create an entry when word is missing.
+ * @return The entry for word or NULL.
+ */
+WordTableEntry *WordTableLookup(WordTable *table, const char *word, unsigned int length, int insert);
+
+#endif
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Generate DictionaryData.c, the const word table declared in Dictionary.h.
+
+The words are sorted into the order LinkedListSort() uses (shorter words first,
+then byte by byte) and duplicates are dropped, so that lists built from the
+table start out sorted. Every word is stored with its length and the sort key
+LinkedListSetData() would compute for it. Run it again whenever the word set changes:
+
+    python3 gen_dictionary.py [word ...] > DictionaryData.c
+
+Without arguments it generates the words used by sort.c.
+"""
+
+import sys
+
+DEFAULT_WORDS = ["dog", "pig", "cow", "cat", "turtle", "bird", "crab"]
+
+# Must match SORT_KEY_MAX_LENGTH in LinkedList.c.
+SORT_KEY_MAX_LENGTH = 253
+
+
+def c_string(word):
+    escaped = []
+    for byte in word.encode():
+        char = chr(byte)
+        if char in '"\\':
+            escaped.append("\\" + char)
+        elif 0x20 <= byte < 0x7F:
+            escaped.append(char)
+        else:
+            escaped.append("\\%03o" % byte)
+    return '"%s"' % "".join(escaped)
+
+
+def sort_key(word):
+    data = word.encode()
+    if len(data) > SORT_KEY_MAX_LENGTH:
+        return 0xFF000000
+    key = (len(data) + 1) << 24
+    for shift, byte in zip((16, 8, 0), data):
+        key |= byte << shift
+    return key
+
+
+def main(argv):
+    words = sorted(set(argv[1:] or DEFAULT_WORDS), key=lambda w: (len(w.encode()), w.encode()))
+    if len(words) > 0xFFFF:
+        sys.exit("gen_dictionary.py: too many words for 16-bit ids")
+    out = sys.stdout
+    out.write("/**\n")
+    out.write(" * @file\n")
+    out.write(" * Generated by gen_dictionary.py, do not edit. This is the word table declared in\n")
+    out.write(" * Dictionary.h, sorted the way LinkedListSort() sorts.\n")
+    out.write(" */\n\n")
+    out.write('#include "Dictionary.h"\n\n')
+    out.write("const DictionaryWord dictionary[] = {\n")
+    for index, word in enumerate(words):
+        out.write("    {%s, %d, %d, 0x%08Xu},\n"
+                  % (c_string(word), len(word.encode()), index + 1, sort_key(word)))
+    out.write("};\n\n")
+    out.write("const int dictionarySize = %d;\n" % len(words))
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,38 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+/**
+ * @file
+ * A stand-in for the CMPE13 support library's BOARD.h for host builds, see host/Makefile. It only
+ * provides what the lab code uses: the return codes, TRUE and FALSE, and BOARD_Init(), which here
+ * just makes stdout unbuffered the way the UART is.
+ */
+
+//Standard Libraries
+#include <stdint.h>
+#include <stdio.h>
+
+// **** Set any macros or preprocessor directives here ****
+#ifndef TRUE
+#define TRUE ((int8_t) 1)
+#endif
+#ifndef FALSE
+#define FALSE ((int8_t) 0)
+#endif
+
+// The return codes of the support library.
+enum {
+    SIZE_ERROR = -1,
+    STANDARD_ERROR,
+    SUCCESS
+};
+
+/**
+ * BOARD_Init() sets up stdout like the board's UART: every character goes out as it is printed.
+ */
+static inline void BOARD_Init(void)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+}
+
+#endif
@@ -0,0 +1,361 @@
+/**
+ * @file
+ * This file is the host (x86) counterpart of Benchmark.c, built by host/Makefile once with
+ * ListItems from malloc() and once with them from the node pool. It runs the same pseudo-random
+ * words as Benchmark.c through every sort backend and word count at 1e3 to 1e6 elements, which do
+ * not fit on the board, and prints one line per measurement in the form
+ *     BENCH,<allocator>,<operation>,<n>,<ns>,<ns per element>,<comparisons>,<swaps>,
+ *           <allocations>,<frees>,<firstVisits>,<sizeVisits>,<peakLive>
+ * The counters come from LINKED_LIST_STATS (comparisons also counts the calls ListNodeSort() makes
+ * to its compare function, but not those of qsort(), which vary with the C library) and are the
+ * same on every run on every machine, so "make check" compares them against the tracked
+ * baseline.txt. The times are left out of that comparison, they are only there for reading and
+ * for perf.
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "IntrusiveList.h"
+
+// **** Set any macros or preprocessor directives here ****
+#ifndef LINKED_LIST_STATS
+#error "The host benchmark reports the LINKED_LIST_STATS counters, build it with host/Makefile."
+#endif
+
+// The same words as Benchmark.c, see there.
+#define BENCHMARK_MAX_WORD_LENGTH 6
+#define BENCHMARK_ALPHABET_SIZE 8
+
+// UnsortedWordCount() is quadratic, so it is only run up to this list size.
+#define BENCHMARK_QUADRATIC_LIMIT 10000
+
+// The units of work every LinkedListSortStep() call gets.
+#define BENCHMARK_SORT_STEP_BUDGET 256
+
+// How many of the most frequent words LinkedListTopK() looks for.
+#define BENCHMARK_TOP_K 10
+
+#if LINKED_LIST_POOL_SIZE > 0
+#define BENCHMARK_ALLOCATOR "pool"
+#else
+#define BENCHMARK_ALLOCATOR "malloc"
+#endif
+
+// **** Declare any data types here ****
+// A word embedded in an IntrusiveList node, for ListNodeSort().
+typedef struct BenchmarkRecord {
+    ListNode node;
+    const char *word;
+    unsigned int length;
+} BenchmarkRecord;
+
+// **** Define any module-level, global, or external variables here ****
+static const int benchmarkSizes[] = {1000, 10000, 100000, 1000000};
+static uint32_t randomState = 2463534242u;
+static uint64_t startTime;
+static uint32_t backendComparisons;
+
+// **** Declare any function prototypes here ****
+int UnsortedWordCount(ListItem *list, int *wordCount);
+int UnsortedWordCountHashed(ListItem *list, int *wordCount);
+int SortedWordCount(ListItem *list, int *wordCount);
+
+/**
+ * BenchmarkRandom() is the xorshift32 generator of Benchmark.c, with the same seed.
+ */
+static uint32_t BenchmarkRandom(void)
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+/**
+ * BenchmarkNow() reads the monotonic clock in nanoseconds.
+ */
+static uint64_t BenchmarkNow(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000u + now.tv_nsec;
+}
+
+/**
+ * BenchmarkStart() zeroes the counters and starts the clock for one measurement.
+ */
+static void BenchmarkStart(void)
+{
+    LinkedListStatsReset();
+    backendComparisons = 0;
+    startTime = BenchmarkNow();
+}
+
+/**
+ * BenchmarkReport() stops the clock and prints the result line of the measurement.
+ */
+static void BenchmarkReport(const char *operation, int n)
+{
+    uint64_t elapsed = BenchmarkNow() - startTime;
+    LinkedListStats stats;
+    LinkedListGetStats(&stats);
+    printf("BENCH,%s,%s,%d,%llu,%llu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n", BENCHMARK_ALLOCATOR,
+            operation, n, (unsigned long long) elapsed, (unsigned long long) (elapsed / n),
+            (unsigned long) (stats.comparisons + backendComparisons), (unsigned long) stats.swaps,
+            (unsigned long) stats.allocations, (unsigned long) stats.frees,
+            (unsigned long) stats.firstVisits, (unsigned long) stats.sizeVisits,
+            (unsigned long) stats.peakLive);
+}
+
+/**
+ * BenchmarkOrder() orders two words the way LinkedListCompare() does: shorter words first, then
+ * byte by byte.
+ */
+static int BenchmarkOrder(const char *first, unsigned int firstLength,
+        const char *second, unsigned int secondLength)
+{
+    if (firstLength != secondLength) {
+        return (firstLength < secondLength) ? -1 : 1;
+    }
+    return memcmp(first, second, firstLength);
+}
+
+/**
+ * BenchmarkCompareWords() is BenchmarkOrder() for qsort() over an array of words.
+ */
+static int BenchmarkCompareWords(const void *first, const void *second)
+{
+    const char *a = *(const char * const *) first;
+    const char *b = *(const char * const *) second;
+    return BenchmarkOrder(a, strlen(a), b, strlen(b));
+}
+
+/**
+ * BenchmarkCompareRecords() is BenchmarkOrder() for ListNodeSort().
+ */
+static int BenchmarkCompareRecords(const ListNode *first, const ListNode *second)
+{
+    const BenchmarkRecord *a = LIST_NODE_ENTRY(first, BenchmarkRecord, node);
+    const BenchmarkRecord *b = LIST_NODE_ENTRY(second, BenchmarkRecord, node);
+    backendComparisons++;
+    return BenchmarkOrder(a->word, a->length, b->word, b->length);
+}
+
+/**
+ * BenchmarkCheck() makes sure that the list starting at head holds the words of sorted, in order. A
+ * backend that sorts differently ends the run, so the counters cannot match the baseline.
+ */
+static void BenchmarkCheck(const char *operation, ListItem *head, char **sorted, int n)
+{
+    int i;
+    for (i = 0; i < n && head != NULL; i++, head = head->nextItem) {
+        if (strcmp(head->data, sorted[i]) != 0) {
+            break;
+        }
+    }
+    if (i != n || head != NULL) {
+        printf("ERROR: %s gave a different order at element %d of %d\n", operation, i, n);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * BenchmarkCheckCounts() makes sure that two word count functions agree on every element, the
+ * same way BenchmarkCheck() does for the sort backends.
+ */
+static void BenchmarkCheckCounts(const char *operation, const int *counts, const int *expected,
+        int n)
+{
+    int i;
+    for (i = 0; i < n && counts[i] == expected[i]; i++);
+    if (i != n) {
+        printf("ERROR: %s gave a different count at element %d of %d\n", operation, i, n);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * BenchmarkRun() generates n words and measures every operation on them. It returns
+ * STANDARD_ERROR if anything does not fit in memory.
+ */
+static int BenchmarkRun(int n)
+{
+    char *letters = malloc((size_t) n * (BENCHMARK_MAX_WORD_LENGTH + 1));
+    char **words = malloc(n * sizeof (char *));
+    char **sorted = malloc(n * sizeof (char *));
+    int *wordCount = malloc(n * sizeof (int));
+    int *referenceCount = malloc(n * sizeof (int));
+    BenchmarkRecord *records = malloc(n * sizeof (BenchmarkRecord));
+    LinkedListSortState state;
+    LinkedListTopWord top[BENCHMARK_TOP_K];
+    ListItem *block, *head, *item;
+    ListNode *node;
+    int i, j, length;
+
+    if (letters == NULL || words == NULL || sorted == NULL || wordCount == NULL
+            || referenceCount == NULL || records == NULL) {
+        free(letters);
+        free(words);
+        free(sorted);
+        free(wordCount);
+        free(referenceCount);
+        free(records);
+        return STANDARD_ERROR;
+    }
+    for (i = 0; i < n; i++) {
+        words[i] = &letters[i * (BENCHMARK_MAX_WORD_LENGTH + 1)];
+        length = 1 + BenchmarkRandom() % BENCHMARK_MAX_WORD_LENGTH;
+        for (j = 0; j < length; j++) {
+            words[i][j] = 'a' + BenchmarkRandom() % BENCHMARK_ALPHABET_SIZE;
+        }
+        words[i][length] = '\0';
+    }
+
+    // The reference order every backend is checked against. qsort() is not stable, but equal
+    // words are indistinguishable here.
+    memcpy(sorted, words, n * sizeof (char *));
+    BenchmarkStart();
+    qsort(sorted, n, sizeof (char *), BenchmarkCompareWords);
+    BenchmarkReport("qsort", n);
+
+    // Allocation: one ListItem at a time, from the heap or the pool, and as one block.
+    BenchmarkStart();
+    head = LinkedListNew(words[0]);
+    for (i = 1, item = head; i < n && item != NULL; i++) {
+        item = LinkedListCreateAfter(item, words[i]);
+    }
+    BenchmarkReport("LinkedListCreateAfter", n);
+    if (item == NULL) {
+        LinkedListFreeAll(head, NULL);
+        free(letters);
+        free(words);
+        free(sorted);
+        free(wordCount);
+        free(referenceCount);
+        free(records);
+        return STANDARD_ERROR;
+    }
+    BenchmarkStart();
+    LinkedListFreeAll(head, NULL);
+    BenchmarkReport("LinkedListFreeAll", n);
+
+    BenchmarkStart();
+    block = LinkedListFromArray(words, n);
+    BenchmarkReport("LinkedListFromArray", n);
+    if (block == NULL) {
+        free(letters);
+        free(words);
+        free(sorted);
+        free(wordCount);
+        free(referenceCount);
+        free(records);
+        return STANDARD_ERROR;
+    }
+
+    // Word counts on the unsorted list. The hashed count must match the quadratic one wherever
+    // that runs.
+    if (n <= BENCHMARK_QUADRATIC_LIMIT) {
+        BenchmarkStart();
+        UnsortedWordCount(block, referenceCount);
+        BenchmarkReport("UnsortedWordCount", n);
+    }
+    BenchmarkStart();
+    UnsortedWordCountHashed(block, wordCount);
+    BenchmarkReport("UnsortedWordCountHashed", n);
+    if (n <= BENCHMARK_QUADRATIC_LIMIT) {
+        BenchmarkCheckCounts("UnsortedWordCountHashed", wordCount, referenceCount, n);
+    }
+    BenchmarkStart();
+    LinkedListTopK(block, BENCHMARK_TOP_K, top);
+    BenchmarkReport("LinkedListTopK", n);
+
+    // Sort backends, each on a fresh unsorted list.
+    BenchmarkStart();
+    LinkedListSort(block);
+    BenchmarkReport("LinkedListSort", n);
+    head = LinkedListGetFirst(block);
+    BenchmarkCheck("LinkedListSort", head, sorted, n);
+
+    BenchmarkStart();
+    SortedWordCount(head, wordCount);
+    BenchmarkReport("SortedWordCount", n);
+    UnsortedWordCountHashed(head, referenceCount);
+    BenchmarkCheckCounts("SortedWordCount", wordCount, referenceCount, n);
+    LinkedListFreeArray(block, n);
+
+    block = LinkedListFromArray(words, n);
+    if (block != NULL) {
+        BenchmarkStart();
+        LinkedListSortRadix(block);
+        BenchmarkReport("LinkedListSortRadix", n);
+        BenchmarkCheck("LinkedListSortRadix", LinkedListGetFirst(block), sorted, n);
+        LinkedListFreeArray(block, n);
+    }
+
+    block = LinkedListFromArray(words, n);
+    if (block != NULL) {
+        BenchmarkStart();
+        LinkedListSortBegin(&state, block);
+        while (!LinkedListSortStep(&state, BENCHMARK_SORT_STEP_BUDGET));
+        BenchmarkReport("LinkedListSortStep", n);
+        BenchmarkCheck("LinkedListSortStep", state.head, sorted, n);
+        LinkedListFreeArray(block, n);
+    }
+
+    for (i = 0; i < n; i++) {
+        ListNodeInit(&records[i].node);
+        records[i].word = words[i];
+        records[i].length = strlen(words[i]);
+        if (i > 0) {
+            ListNodeInsertAfter(&records[i - 1].node, &records[i].node);
+        }
+    }
+    BenchmarkStart();
+    node = ListNodeSort(&records[0].node, BenchmarkCompareRecords);
+    BenchmarkReport("ListNodeSort", n);
+    for (i = 0; i < n && node != NULL; i++, node = node->next) {
+        if (strcmp(LIST_NODE_ENTRY(node, BenchmarkRecord, node)->word, sorted[i]) != 0) {
+            break;
+        }
+    }
+    if (i != n || node != NULL) {
+        printf("ERROR: ListNodeSort gave a different order at element %d of %d\n", i, n);
+        exit(EXIT_FAILURE);
+    }
+
+    free(letters);
+    free(words);
+    free(sorted);
+    free(wordCount);
+    free(referenceCount);
+    free(records);
+    return SUCCESS;
+}
+
+int main()
+{
+    BOARD_Init();
+
+    unsigned int i;
+    printf("BENCH,allocator,operation,n,ns,ns_per_element,comparisons,swaps,allocations,frees,"
+            "firstVisits,sizeVisits,peakLive\n");
+    for (i = 0; i < sizeof (benchmarkSizes) / sizeof (benchmarkSizes[0]); i++) {
+        if (BenchmarkRun(benchmarkSizes[i]) != SUCCESS) {
+            printf("BENCH,%s,SKIPPED,%d,0,0,0,0,0,0,0,0,0\n", BENCHMARK_ALLOCATOR,
+                    benchmarkSizes[i]);
+        }
+    }
+    printf("BENCH,%s,DONE,0,0,0,0,0,0,0,0,0,0\n", BENCHMARK_ALLOCATOR);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,1626 @@
+/**
+ * @file
+ * This file holds the behavioural tests for the lab code, built by "make test" in host/Makefile
+ * with AddressSanitizer and UndefinedBehaviorSanitizer, once for each way ListItems can be
+ * allocated and once with LINKED_LIST_INTERN. Every CHECK() that fails is printed with its line,
+ * and the program exits with a failure status if any did.
+ *
+ * Each feature of the library has its own Test...() function, and main() runs them in the order
+ * the features were added. The HostTest...() helpers are shared between them. Every test frees
+ * what it builds and empties the intern table again, so the tests do not depend on each other.
+ *
+ * UartQueue is replaced by a model of its transmit buffer that the tests can fill and drain, and
+ * that feeds received bytes straight to the installed receive handler.
+ */
+
+// **** Include libraries here ****
+// Standard libraries
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "LinkedList.h"
+#include "SkipList.h"
+#include "UnrolledList.h"
+#include "ArrayList.h"
+#include "IntrusiveList.h"
+#include "WordStream.h"
+#include "Dictionary.h"
+#include "WordTable.h"
+#include "FastString.h"
+#include "UartQueue.h"
+
+// **** Set any macros or preprocessor directives here ****
+#define CHECK(condition) HostTestCheck((condition), #condition, __LINE__)
+
+// The most text HostTestJoin() and the transmit model keep.
+#define HOST_TEST_TEXT_SIZE 4096
+
+// The most elements the UnrolledList and ArrayList tests keep in their array models.
+#define HOST_TEST_MODEL_SIZE 64
+
+// The most words the sort tests sort at once.
+#define HOST_TEST_SORT_SIZE 200
+
+// **** Declare any data types here ****
+// A record for the IntrusiveList tests, with its node in the middle.
+typedef struct {
+    int key;
+    ListNode node;
+    int position;
+} HostTestRecord;
+
+// **** Define any module-level, global, or external variables here ****
+static int checks = 0;
+static int failures = 0;
+static char txText[HOST_TEST_TEXT_SIZE];
+static int txUsed = 0;
+static int txSent = 0;
+static UartQueueRxHandler rxHandler = NULL;
+static char freedText[HOST_TEST_TEXT_SIZE];
+static uint32_t randomState = 2463534242u;
+
+// **** Declare any function prototypes here ****
+int UnsortedWordCount(ListItem *list, int *wordCount);
+int UnsortedWordCountHashed(ListItem *list, int *wordCount);
+int SortedWordCount(ListItem *list, int *wordCount);
+
+/**
+ * HostTestRandom() is the xorshift32 generator of the benchmarks, for reproducible operations.
+ */
+static uint32_t HostTestRandom(void)
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+/**
+ * HostTestCheck() counts one check and reports it if it failed.
+ */
+static void HostTestCheck(int passed, const char *condition, int line)
+{
+    checks++;
+    if (!passed) {
+        failures++;
+        printf("HostTest.c:%d: CHECK(%s) failed\n", line, condition);
+    }
+}
+
+/**
+ * UartQueueInit() empties the transmit model and forgets everything sent so far.
+ */
+void UartQueueInit(void)
+{
+    txUsed = 0;
+    txSent = 0;
+}
+
+/**
+ * UartQueueWrite() queues as much of data as fits, like the real transmit buffer.
+ */
+int UartQueueWrite(const char *data, int length)
+{
+    int room = UartQueueFree();
+    if (length > room) {
+        length = room;
+    }
+    if (length > HOST_TEST_TEXT_SIZE - 1 - txUsed) {
+        length = HOST_TEST_TEXT_SIZE - 1 - txUsed;
+    }
+    memcpy(&txText[txUsed], data, length);
+    txUsed += length;
+    txText[txUsed] = '\0';
+    return length;
+}
+
+/**
+ * UartQueueFree() returns the room left in a transmit buffer of UART_QUEUE_TX_SIZE bytes.
+ */
+int UartQueueFree(void)
+{
+    return UART_QUEUE_TX_SIZE - 1 - (txUsed - txSent);
+}
+
+/**
+ * UartQueueIdle() checks whether everything queued has been drained.
+ */
+int UartQueueIdle(void)
+{
+    return txSent == txUsed;
+}
+
+/**
+ * UartQueueSetRxHandler() installs the handler HostTestReceive() feeds.
+ */
+void UartQueueSetRxHandler(UartQueueRxHandler handler)
+{
+    rxHandler = handler;
+}
+
+/**
+ * HostTestDrain() pretends the UART has sent everything queued.
+ */
+static void HostTestDrain(void)
+{
+    txSent = txUsed;
+}
+
+/**
+ * HostTestReceive() hands length bytes of text to the receive handler, as the UART would.
+ */
+static void HostTestReceive(const char *text, int length)
+{
+    int i;
+    for (i = 0; i < length && rxHandler != NULL; i++) {
+        rxHandler(text[i]);
+    }
+}
+
+/**
+ * HostTestForgetWords() empties the intern table, when there is one. No ListItem may be left.
+ */
+static void HostTestForgetWords(void)
+{
+#ifdef LINKED_LIST_INTERN
+    LinkedListInternReset();
+#endif
+}
+
+/**
+ * HostTestJoin() writes the words of the list that list belongs to into text, separated by
+ * commas and with "(null)" for NULL data, so that a whole list can be checked with one strcmp().
+ * It also checks that the links run both ways.
+ */
+static const char *HostTestJoin(ListItem *list)
+{
+    static char text[HOST_TEST_TEXT_SIZE];
+    ListItem *item = LinkedListGetFirst(list);
+    int used = 0;
+
+    text[0] = '\0';
+    for (; item != NULL; item = item->nextItem) {
+        if (item->nextItem != NULL) {
+            CHECK(item->nextItem->previousItem == item);
+        }
+        used += snprintf(&text[used], sizeof (text) - used, "%s%s", used > 0 ? "," : "",
+                item->data == NULL ? "(null)" : item->data);
+    }
+    return text;
+}
+
+/**
+ * HostTestHeader() checks that header really tracks its list: head, tail, size and every owner.
+ */
+static void HostTestHeader(const LinkedList *header)
+{
+    ListItem *item;
+    int size = 0;
+    for (item = header->head; item != NULL; item = item->nextItem) {
+        CHECK(item->owner == header);
+        if (item->nextItem == NULL) {
+            CHECK(header->tail == item);
+        }
+        size++;
+    }
+    CHECK(header->size == size);
+    CHECK(header->head == NULL || header->head->previousItem == NULL);
+    if (header->head == NULL) {
+        CHECK(header->tail == NULL);
+    }
+}
+
+/**
+ * HostTestBuild() fills header with the n words of words, in order.
+ */
+static void HostTestBuild(LinkedList *header, char **words, int n)
+{
+    int i;
+    LinkedListInit(header);
+    for (i = 0; i < n; i++) {
+        CHECK(LinkedListAppend(header, words[i]) != NULL);
+    }
+}
+
+/**
+ * HostTestFree() frees the list of header and leaves it empty.
+ */
+static void HostTestFree(LinkedList *header)
+{
+    if (header->head != NULL) {
+        LinkedListFreeAll(header->head, NULL);
+    }
+    LinkedListInit(header);
+}
+
+/**
+ * HostTestSameCounts() checks that two word count arrays of n elements are equal.
+ */
+static int HostTestSameCounts(const int *counts, const int *expected, int n)
+{
+    int i;
+    for (i = 0; i < n && counts[i] == expected[i]; i++);
+    return i == n;
+}
+
+/**
+ * HostTestSortBefore() is the order LinkedListSort() documents, worked out from scratch with
+ * strlen() and strcmp(): NULL first, then shorter words first, then alphabetically.
+ */
+static int HostTestSortBefore(const char *first, const char *second)
+{
+    if (first == NULL || second == NULL) {
+        return first == NULL && second != NULL;
+    }
+    if (strlen(first) != strlen(second)) {
+        return strlen(first) < strlen(second);
+    }
+    return strcmp(first, second) < 0;
+}
+
+/**
+ * HostTestRandomWords() fills words with n random short words over a small alphabet, so that there
+ * are many duplicates and shared prefixes, and the odd NULL. Every word is stored separately.
+ */
+static void HostTestRandomWords(char **words, char (*storage)[16], int n)
+{
+    int i, j, length;
+    for (i = 0; i < n; i++) {
+        length = HostTestRandom() % 7;
+        for (j = 0; j < length; j++) {
+            storage[i][j] = "abc"[HostTestRandom() % 3];
+        }
+        storage[i][length] = '\0';
+        words[i] = (HostTestRandom() % 13 == 0) ? NULL : storage[i];
+    }
+}
+
+/**
+ * HostTestBuildItems() is HostTestBuild() that also keeps the ListItems in items, in list order.
+ */
+static void HostTestBuildItems(LinkedList *header, ListItem **items, char **words, int n)
+{
+    int i;
+    LinkedListInit(header);
+    for (i = 0; i < n; i++) {
+        items[i] = LinkedListAppend(header, words[i]);
+    }
+}
+
+/**
+ * HostTestCheckSorted() checks that the list of header holds items, the n ListItems just built by
+ * HostTestBuildItems() from words, stably sorted into the order of HostTestSortBefore().
+ */
+static void HostTestCheckSorted(const LinkedList *header, ListItem **items, char **words, int n)
+{
+    int order[HOST_TEST_SORT_SIZE];
+    ListItem *item;
+    int i, j, same = TRUE;
+
+    // A stable insertion sort of the positions gives the expected order.
+    for (i = 0; i < n; i++) {
+        for (j = i; j > 0 && HostTestSortBefore(words[i], words[order[j - 1]]); j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+    }
+    for (item = header->head, i = 0; item != NULL && i < n; item = item->nextItem, i++) {
+        same = same && item == items[order[i]];
+    }
+    CHECK(same && item == NULL && i == n);
+    CHECK(header->sorted);
+    HostTestHeader(header);
+}
+
+/**
+ * TestSort() checks LinkedListSort() against a reference sort on random words of every size from a
+ * single word up, for both order and stability.
+ */
+static void TestSort(void)
+{
+    static char storage[HOST_TEST_SORT_SIZE][16];
+    char *words[HOST_TEST_SORT_SIZE];
+    char *example[] = {"dog", "cat", "duck", "goat", NULL};
+    int sizes[] = {1, 2, 3, 7, 64, HOST_TEST_SORT_SIZE};
+    ListItem *items[HOST_TEST_SORT_SIZE];
+    LinkedList list;
+    int i;
+
+    HostTestBuild(&list, example, 5);
+    CHECK(LinkedListSort(list.head) == SUCCESS);
+    CHECK(strcmp(HostTestJoin(list.head), "(null),cat,dog,duck,goat") == 0);
+    CHECK(LinkedListSort(NULL) == STANDARD_ERROR);
+    HostTestFree(&list);
+
+    HostTestRandomWords(words, storage, HOST_TEST_SORT_SIZE);
+    for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++) {
+        HostTestBuildItems(&list, items, words, sizes[i]);
+        CHECK(LinkedListSort(list.tail) == SUCCESS);
+        HostTestCheckSorted(&list, items, words, sizes[i]);
+        CHECK(LinkedListSort(list.head) == SUCCESS);
+        HostTestCheckSorted(&list, items, words, sizes[i]);
+        HostTestFree(&list);
+    }
+    HostTestForgetWords();
+}
+
+/**
+ * TestCachedLength() checks that every way of storing data keeps the cached length right.
+ */
+static void TestCachedLength(void)
+{
+    char *words[] = {"platypus", NULL, "", "a"};
+    LinkedList list;
+    ListItem *block, *item;
+    int i, same = TRUE;
+
+    HostTestBuild(&list, words, 4);
+    CHECK(list.head->length == 8 && list.head->nextItem->length == 0);
+    CHECK(list.tail->previousItem->length == 0 && list.tail->length == 1);
+    CHECK(LinkedListSetData(list.head, "corvid") == SUCCESS && list.head->length == 6);
+    CHECK(LinkedListSetData(list.head, NULL) == SUCCESS && list.head->length == 0);
+    CHECK(LinkedListSwapData(list.head, list.tail) == SUCCESS);
+    CHECK(list.head->length == 1 && list.tail->length == 0);
+    CHECK(LinkedListCreateAfter(list.head, "giraffe")->length == 7);
+    HostTestFree(&list);
+
+    block = LinkedListFromArray(words, 4);
+    for (item = block, i = 0; item != NULL; item = item->nextItem, i++) {
+        same = same && item->length == (words[i] == NULL ? 0 : strlen(words[i]));
+    }
+    CHECK(same && i == 4);
+    CHECK(LinkedListFreeArray(block, 4) == SUCCESS);
+    HostTestForgetWords();
+}
+
+/**
+ * TestSortKey() checks the packed sort keys, and that LinkedListCompare() agrees with
+ * HostTestSortBefore() on every pair of words, also where the keys are equal.
+ */
+static void TestSortKey(void)
+{
+    char longest[254], tooLong[255], tooLongLater[255], longer[300];
+    char *words[] = {NULL, "", "a", "b", "ab", "abc", "abd", "abcd", "abce", "abdd", "\xff",
+        "a\xff", longest, tooLong, tooLongLater, longer};
+    int n = sizeof (words) / sizeof (words[0]);
+    ListItem first, second;
+    int i, j, order, same = TRUE;
+
+    memset(longest, 'x', sizeof (longest) - 1);
+    longest[sizeof (longest) - 1] = '\0';
+    memset(tooLong, 'x', sizeof (tooLong) - 1);
+    tooLong[sizeof (tooLong) - 1] = '\0';
+    strcpy(tooLongLater, tooLong);
+    tooLongLater[200] = 'y';
+    memset(longer, 'a', sizeof (longer) - 1);
+    longer[sizeof (longer) - 1] = '\0';
+
+    LinkedListInitProbe(&first, NULL);
+    CHECK(first.sortKey == 0);
+    LinkedListInitProbe(&first, "");
+    CHECK(first.sortKey == 0x01000000u);
+    LinkedListInitProbe(&first, "ab");
+    CHECK(first.sortKey == 0x03616200u);
+    LinkedListInitProbe(&first, "abcd");
+    CHECK(first.sortKey == 0x05616263u);
+    LinkedListInitProbe(&first, longest);
+    CHECK(first.sortKey == 0xFE787878u);
+    LinkedListInitProbe(&first, tooLong);
+    CHECK(first.sortKey == 0xFF000000u);
+
+    for (i = 0; i < n; i++) {
+        for (j = 0; j < n; j++) {
+            LinkedListInitProbe(&first, words[i]);
+            LinkedListInitProbe(&second, words[j]);
+            order = LinkedListCompare(&first, &second);
+            if (HostTestSortBefore(words[i], words[j])) {
+                same = same && order < 0;
+            } else if (HostTestSortBefore(words[j], words[i])) {
+                same = same && order > 0;
+            } else {
+                same = same && order == 0;
+            }
+        }
+    }
+    CHECK(same);
+}
+
+/**
+ * TestSortRadix() checks that LinkedListSortRadix() gives exactly the order of the reference sort,
+ * also for words longer than LINKED_LIST_RADIX_MAX_LENGTH that share the last bucket.
+ */
+static void TestSortRadix(void)
+{
+    static char storage[HOST_TEST_SORT_SIZE][16];
+    char *words[HOST_TEST_SORT_SIZE];
+    char *longWords[] = {"abcdefghijklmnopqrstuv", "abcdefghijklmnopq", "abcdefghijklmnopqrstuu",
+        "bbcdefghijklmnopq", "abcdefghijklmnop"};
+    int sizes[] = {1, 2, 5, 64, HOST_TEST_SORT_SIZE};
+    ListItem *items[HOST_TEST_SORT_SIZE];
+    LinkedList list;
+    int i;
+
+    HostTestRandomWords(words, storage, HOST_TEST_SORT_SIZE);
+    for (i = 3; i < HOST_TEST_SORT_SIZE; i += 9) {
+        words[i] = longWords[i % 5];
+    }
+    for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++) {
+        HostTestBuildItems(&list, items, words, sizes[i]);
+        CHECK(LinkedListSortRadix(list.tail) == SUCCESS);
+        HostTestCheckSorted(&list, items, words, sizes[i]);
+        HostTestFree(&list);
+    }
+    CHECK(LinkedListSortRadix(NULL) == STANDARD_ERROR);
+    HostTestForgetWords();
+}
+
+/**
+ * TestSortStep() checks that a time-sliced sort gives exactly the order of the reference sort for
+ * every budget, from one unit per step up, and stays within the documented amount of work.
+ */
+static void TestSortStep(void)
+{
+    static char storage[HOST_TEST_SORT_SIZE][16];
+    char *words[HOST_TEST_SORT_SIZE];
+    int budgets[] = {1, 2, 7, 100, 1000000};
+    int sizes[] = {1, 2, 3, 64, HOST_TEST_SORT_SIZE};
+    ListItem *items[HOST_TEST_SORT_SIZE];
+    LinkedListSortState state;
+    LinkedList list;
+    int i, j, steps, passes;
+
+    HostTestRandomWords(words, storage, HOST_TEST_SORT_SIZE);
+    for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++) {
+        for (passes = 0; (1 << passes) < sizes[i]; passes++);
+        for (j = 0; j < sizeof (budgets) / sizeof (budgets[0]); j++) {
+            HostTestBuildItems(&list, items, words, sizes[i]);
+            CHECK(LinkedListSortBegin(&state, list.tail) == SUCCESS);
+            // Every step but the last uses its whole budget.
+            for (steps = 1; !LinkedListSortStep(&state, budgets[j]); steps++) {
+                CHECK(!LinkedListSortDone(&state));
+            }
+            CHECK(LinkedListSortDone(&state) && state.head == list.head);
+            CHECK((steps - 1) * budgets[j] < (2 * passes + 4) * sizes[i] + 4);
+            HostTestCheckSorted(&list, items, words, sizes[i]);
+            HostTestFree(&list);
+        }
+    }
+    CHECK(LinkedListSortBegin(NULL, items[0]) == STANDARD_ERROR);
+    CHECK(LinkedListSortBegin(&state, NULL) == STANDARD_ERROR);
+    HostTestForgetWords();
+}
+
+/**
+ * TestUnsortedWordCount() checks that the hashed word count gives exactly what the quadratic one
+ * does, also once the list holds more distinct words than a WordTable takes.
+ */
+static void TestUnsortedWordCount(void)
+{
+    char *words[] = {NULL, "platypus", "giraffe", "", "corvid", "slug", "", NULL, "platypus",
+        "platypus"};
+    int expected[] = {0, 3, 1, 2, 1, 1, -2, 0, -3, -3};
+    char manyWords[WORD_TABLE_CAPACITY][16];
+    int counts[2 * WORD_TABLE_CAPACITY], reference[2 * WORD_TABLE_CAPACITY];
+    LinkedList list;
+    int i;
+
+    HostTestBuild(&list, words, 10);
+    CHECK(UnsortedWordCount(list.head, reference) == SUCCESS);
+    CHECK(HostTestSameCounts(reference, expected, 10));
+    CHECK(UnsortedWordCountHashed(list.head, counts) == SUCCESS);
+    CHECK(HostTestSameCounts(counts, expected, 10));
+    CHECK(UnsortedWordCountHashed(list.tail, counts) == STANDARD_ERROR);
+    HostTestFree(&list);
+    HostTestForgetWords();
+
+    // Every distinct word twice, with a NULL in between now and then, takes the fallback.
+    LinkedListInit(&list);
+    for (i = 0; i < 2 * WORD_TABLE_CAPACITY; i++) {
+        if (i % 9 == 4) {
+            LinkedListAppend(&list, NULL);
+        } else {
+            snprintf(manyWords[i / 2], sizeof (manyWords[i / 2]), "w%d", i / 2);
+            LinkedListAppend(&list, manyWords[i / 2]);
+        }
+    }
+    CHECK(UnsortedWordCount(list.head, reference) == SUCCESS);
+    CHECK(UnsortedWordCountHashed(list.head, counts) == SUCCESS);
+    CHECK(HostTestSameCounts(counts, reference, 2 * WORD_TABLE_CAPACITY));
+    CHECK(reference[4] == 0 && reference[0] == 2 && reference[1] == -2);
+    HostTestFree(&list);
+    HostTestForgetWords();
+}
+
+/**
+ * HostTestCheckSortedCounts() checks SortedWordCount() on the n words of words, which must be in
+ * sorted runs, against UnsortedWordCount() and LinkedListWordCount() on the same list, and leaves
+ * its result in counts.
+ */
+static void HostTestCheckSortedCounts(char **words, int n, int *counts)
+{
+    int reference[16];
+    LinkedList list;
+    ListItem *item;
+    int i;
+
+    HostTestBuild(&list, words, n);
+    CHECK(SortedWordCount(list.head, counts) == SUCCESS);
+    CHECK(UnsortedWordCount(list.head, reference) == SUCCESS);
+    CHECK(HostTestSameCounts(counts, reference, n));
+    for (item = list.head, i = 0; item != NULL; item = item->nextItem, i++) {
+        CHECK(LinkedListWordCount(item) == counts[i]);
+    }
+    CHECK(n == 1 || SortedWordCount(list.tail, reference) == STANDARD_ERROR);
+    HostTestFree(&list);
+    HostTestForgetWords();
+}
+
+/**
+ * TestSortedWordCount() checks the run-length count with NULLs before and after the words and
+ * with runs of equal words at both ends of the list.
+ */
+static void TestSortedWordCount(void)
+{
+    char *nullEnds[] = {NULL, NULL, "a", "a", "bb", "cc", "cc", "cc", NULL};
+    char *wordEnds[] = {"a", "a", "a", "bb", NULL, "cc", "dd", "dd"};
+    char *single[] = {"a"};
+    int counts[9];
+
+    HostTestCheckSortedCounts(nullEnds, 9, counts);
+    CHECK(counts[0] == 0 && counts[1] == 0 && counts[2] == 2 && counts[3] == -2
+            && counts[4] == 1 && counts[5] == 3 && counts[7] == -3 && counts[8] == 0);
+    HostTestCheckSortedCounts(wordEnds, 8, counts);
+    CHECK(counts[0] == 3 && counts[2] == -3 && counts[4] == 0 && counts[5] == 1
+            && counts[6] == 2 && counts[7] == -2);
+    HostTestCheckSortedCounts(single, 1, counts);
+    CHECK(counts[0] == 1);
+    HostTestCheckSortedCounts(&nullEnds[8], 1, counts);
+    CHECK(counts[0] == 0);
+}
+
+/**
+ * HostTestFreeData() is a LinkedListFreeDataFunction that writes the words it is given into
+ * freedText, separated by commas, instead of freeing them.
+ */
+static void HostTestFreeData(char *data)
+{
+    int used = strlen(freedText);
+    CHECK(data != NULL);
+    snprintf(&freedText[used], sizeof (freedText) - used, "%s%s", used > 0 ? "," : "",
+            data == NULL ? "(null)" : data);
+}
+
+/**
+ * TestFreeRange() frees ranges at the head, in the middle and at the tail of a list with a header,
+ * then the whole list, and checks the header and which data was passed to freeData.
+ */
+static void TestFreeRange(void)
+{
+    char *words[] = {"a", NULL, "c", "d", "e", NULL, "g", "h"};
+    LinkedList list;
+
+    freedText[0] = '\0';
+    HostTestBuild(&list, words, 8);
+    CHECK(LinkedListFreeRange(list.head, list.head->nextItem, HostTestFreeData) == SUCCESS);
+    CHECK(strcmp(HostTestJoin(list.head), "c,d,e,(null),g,h") == 0);
+    CHECK(list.size == 6 && strcmp(list.head->data, "c") == 0);
+    HostTestHeader(&list);
+
+    CHECK(LinkedListFreeRange(list.head->nextItem, list.tail->previousItem->previousItem,
+            HostTestFreeData) == SUCCESS);
+    CHECK(strcmp(HostTestJoin(list.head), "c,g,h") == 0);
+    CHECK(list.size == 3);
+    HostTestHeader(&list);
+
+    CHECK(LinkedListFreeRange(list.tail, NULL, HostTestFreeData) == SUCCESS);
+    CHECK(strcmp(HostTestJoin(list.head), "c,g") == 0);
+    CHECK(list.size == 2 && strcmp(list.tail->data, "g") == 0);
+    HostTestHeader(&list);
+
+    CHECK(LinkedListFreeAll(list.tail, HostTestFreeData) == SUCCESS);
+    CHECK(list.head == NULL && list.tail == NULL && list.size == 0);
+    CHECK(strcmp(freedText, "a,d,e,h,c,g") == 0);
+    CHECK(LinkedListFreeRange(NULL, NULL, HostTestFreeData) == STANDARD_ERROR);
+    CHECK(LinkedListFreeAll(NULL, NULL) == STANDARD_ERROR);
+    HostTestForgetWords();
+}
+
+/**
+ * TestSpliceSplitConcat() checks the list surgery functions, above all their header bookkeeping.
+ */
+static void TestSpliceSplitConcat(void)
+{
+    char *left[] = {"a", "b", "c", "d"};
+    char *right[] = {"x", "y", "z"};
+    LinkedList a, b;
+    ListItem *tail;
+
+    // A run moved within one list.
+    HostTestBuild(&a, left, 4);
+    CHECK(LinkedListSplice(a.head, a.head->nextItem->nextItem, a.tail) == SUCCESS);
+    CHECK(strcmp(HostTestJoin(a.head), "a,c,d,b") == 0);
+    HostTestHeader(&a);
+    CHECK(a.size == 4);
+    CHECK(LinkedListSplice(a.head, a.head, a.tail) == STANDARD_ERROR);
+
+    // A run moved between two headers.
+    HostTestBuild(&b, right, 3);
+    CHECK(LinkedListSplice(b.tail, a.head->nextItem, a.head->nextItem->nextItem) == SUCCESS);
+    CHECK(strcmp(HostTestJoin(a.head), "a,b") == 0);
+    CHECK(strcmp(HostTestJoin(b.head), "x,y,z,c,d") == 0);
+    HostTestHeader(&a);
+    HostTestHeader(&b);
+
+    // Splitting leaves the front under the header and the back on its own.
+    tail = LinkedListSplit(b.head->nextItem->nextItem);
+    CHECK(tail != NULL && tail->previousItem == NULL);
+    CHECK(strcmp(HostTestJoin(b.head), "x,y") == 0);
+    CHECK(strcmp(HostTestJoin(tail), "z,c,d") == 0);
+    CHECK(tail->owner == NULL && tail->nextItem->owner == NULL);
+    HostTestHeader(&b);
+    CHECK(LinkedListSplit(NULL) == NULL);
+
+    // Concatenating with and without headers.
+    CHECK(LinkedListConcat(a.head, tail) == a.head);
+    CHECK(strcmp(HostTestJoin(a.head), "a,b,z,c,d") == 0);
+    CHECK(a.size == 5);
+    HostTestHeader(&a);
+    CHECK(LinkedListConcat(b.tail, a.head) == b.head);
+    CHECK(strcmp(HostTestJoin(b.head), "x,y,a,b,z,c,d") == 0);
+    HostTestHeader(&b);
+    CHECK(a.head == NULL && a.size == 0);
+    CHECK(LinkedListConcat(b.head, b.tail) == NULL);
+
+    HostTestFree(&b);
+    HostTestForgetWords();
+}
+
+/**
+ * TestMergeSorted() checks that merging sorted lists gives what sorting them all together would.
+ */
+static void TestMergeSorted(void)
+{
+    char *first[] = {"cow", "bb", NULL, "a", "ddd"};
+    char *second[] = {"bb", "e", "ab"};
+    char *third[] = {"a", "zzzz"};
+    LinkedList a, b, c;
+    ListItem *lists[4];
+    ListItem *head;
+
+    HostTestBuild(&a, first, 5);
+    HostTestBuild(&b, second, 3);
+    HostTestBuild(&c, third, 2);
+    LinkedListSort(a.head);
+    LinkedListSort(b.head);
+    LinkedListSort(c.head);
+    lists[0] = NULL;
+    lists[1] = a.head;
+    lists[2] = b.head;
+    lists[3] = c.head;
+    head = LinkedListMergeSorted(lists, 4);
+    CHECK(strcmp(HostTestJoin(head), "(null),a,a,e,ab,bb,bb,cow,ddd,zzzz") == 0);
+    CHECK(a.head == head && a.size == 10 && a.sorted);
+    HostTestHeader(&a);
+    CHECK(b.head == NULL && b.size == 0 && c.head == NULL && c.size == 0);
+
+
+    CHECK(LinkedListMergeSorted(NULL, 2) == NULL);
+    CHECK(LinkedListMergeSorted(lists, LINKED_LIST_MERGE_MAX_LISTS + 1) == NULL);
+    HostTestFree(&a);
+    HostTestForgetWords();
+}
+
+/**
+ * TestUniqueCount() checks collapsing runs of equal words.
+ */
+static void TestUniqueCount(void)
+{
+    char *words[] = {"bb", "a", NULL, "bb", "a", "bb", NULL, "ccc"};
+    int counts[8];
+    LinkedList list;
+
+    HostTestBuild(&list, words, 8);
+    CHECK(LinkedListUniqueCount(list.head, counts, NULL) == 5);
+    CHECK(strcmp(HostTestJoin(list.head), "(null),(null),a,bb,ccc") == 0);
+    CHECK(counts[0] == 0 && counts[1] == 0 && counts[2] == 2 && counts[3] == 3
+            && counts[4] == 1);
+    CHECK(list.sorted);
+    HostTestHeader(&list);
+    CHECK(LinkedListUniqueCount(NULL, counts, NULL) == 0);
+    HostTestFree(&list);
+    HostTestForgetWords();
+}
+
+/**
+ * TestSwapData() checks that swapping data takes a list out of sorted order for the functions that
+ * trust LinkedList.sorted.
+ */
+static void TestSwapData(void)
+{
+    char *words[] = {"a", "bb", "ccc"};
+    LinkedList list;
+
+    HostTestBuild(&list, words, 3);
+    LinkedListSort(list.head);
+    CHECK(list.sorted);
+    CHECK(LinkedListSwapData(list.head, list.tail) == SUCCESS);
+    CHECK(!list.sorted);
+    CHECK(strcmp(HostTestJoin(list.head), "ccc,bb,a") == 0);
+    LinkedListSort(list.head);
+    CHECK(strcmp(HostTestJoin(list.head), "a,bb,ccc") == 0);
+    CHECK(LinkedListInsertSorted(&list, "dd") != NULL);
+    CHECK(strcmp(HostTestJoin(list.head), "a,bb,dd,ccc") == 0);
+    HostTestHeader(&list);
+    CHECK(LinkedListSwapData(list.head, NULL) == STANDARD_ERROR);
+    HostTestFree(&list);
+    HostTestForgetWords();
+}
+
+/**
+ * HostTestCheckUnrolled() checks that list holds the n words of model, in order, and that its
+ * nodes are linked both ways, none is empty and the counts add up.
+ */
+static void HostTestCheckUnrolled(const UnrolledList *list, char **model, int n)
+{
+    const UnrolledNode *node, *previous = NULL;
+    int i, total = 0, same = TRUE;
+    for (node = list->head; node != NULL; previous = node, node = node->next) {
+        CHECK(node->previous == previous);
+        CHECK(node->count > 0 && node->count <= UNROLLED_LIST_NODE_CAPACITY);
+        for (i = 0; i < node->count; i++, total++) {
+            same = same && total < n && node->data[i] == model[total];
+        }
+    }
+    CHECK(list->tail == previous);
+    CHECK(same && total == n && UnrolledListSize(list) == n);
+}
+
+/**
+ * HostTestUnrolledAt() moves it to element position of list, or past the end.
+ */
+static void HostTestUnrolledAt(const UnrolledList *list, UnrolledListIterator *it, int position)
+{
+    UnrolledListFirst(list, it);
+    while (position-- > 0) {
+        UnrolledListNext(it);
+    }
+}
+
+/**
+ * TestUnrolledList() runs inserts and removes against an array model: first right at the node
+ * boundaries, where nodes are split and merged, then at random positions.
+ */
+static void TestUnrolledList(void)
+{
+    char words[HOST_TEST_MODEL_SIZE][16];
+    char *model[HOST_TEST_MODEL_SIZE];
+    UnrolledList list;
+    UnrolledListIterator it;
+    int i, n = 0, position, wrong = 0;
+
+    for (i = 0; i < HOST_TEST_MODEL_SIZE; i++) {
+        snprintf(words[i], sizeof (words[i]), "u%d", i);
+    }
+    UnrolledListInit(&list);
+    UnrolledListFirst(&list, &it);
+    CHECK(!UnrolledListValid(&it) && UnrolledListRemove(&list, &it) == NULL);
+
+    // One full node, then an insert after its last element splits it.
+    for (n = 0; n < UNROLLED_LIST_NODE_CAPACITY; n++) {
+        model[n] = (n == 3) ? NULL : words[n];
+        CHECK(UnrolledListAppend(&list, model[n]) == SUCCESS);
+    }
+    CHECK(list.head == list.tail);
+    HostTestUnrolledAt(&list, &it, n - 1);
+    CHECK(UnrolledListInsertAfter(&list, &it, words[n]) == SUCCESS);
+    model[n] = words[n];
+    n++;
+    CHECK(UnrolledListData(&it) == words[n - 1] && list.head != list.tail);
+    HostTestCheckUnrolled(&list, model, n);
+
+    // An insert that lands exactly on the split point of a full node stays in the lower half.
+    while (list.head->count < UNROLLED_LIST_NODE_CAPACITY) {
+        HostTestUnrolledAt(&list, &it, 0);
+        CHECK(UnrolledListInsertAfter(&list, &it, words[n]) == SUCCESS);
+        memmove(&model[2], &model[1], (n - 1) * sizeof (char *));
+        model[1] = words[n++];
+    }
+    position = UNROLLED_LIST_NODE_CAPACITY / 2 - 1;
+    HostTestUnrolledAt(&list, &it, position);
+    CHECK(UnrolledListInsertAfter(&list, &it, words[n]) == SUCCESS);
+    memmove(&model[position + 2], &model[position + 1], (n - position - 1) * sizeof (char *));
+    model[position + 1] = words[n++];
+    CHECK(it.node == list.head && UnrolledListData(&it) == words[n - 1]);
+    HostTestCheckUnrolled(&list, model, n);
+
+    // Removing from the front of the first node until it merges with the next one.
+    while (list.head->next != NULL && list.head->count >= UNROLLED_LIST_NODE_CAPACITY / 2) {
+        HostTestUnrolledAt(&list, &it, 0);
+        CHECK(UnrolledListRemove(&list, &it) == model[0]);
+        memmove(&model[0], &model[1], --n * sizeof (char *));
+        CHECK(UnrolledListValid(&it) && UnrolledListData(&it) == model[0]);
+        HostTestCheckUnrolled(&list, model, n);
+    }
+
+    // Removing the last element leaves the iterator past the end.
+    HostTestUnrolledAt(&list, &it, n - 1);
+    CHECK(UnrolledListRemove(&list, &it) == model[--n]);
+    CHECK(!UnrolledListValid(&it));
+    HostTestCheckUnrolled(&list, model, n);
+
+    // Random inserts and removes, a few more inserts so that the list keeps growing into more
+    // nodes, checking where the iterator ends up every time.
+    for (i = 0; i < 2000; i++) {
+        position = (n == 0) ? 0 : HostTestRandom() % n;
+        HostTestUnrolledAt(&list, &it, position);
+        if (n < HOST_TEST_MODEL_SIZE - 1 && (n == 0 || HostTestRandom() % 5 < 3)) {
+            if (n == 0) {
+                position = -1;
+            }
+            CHECK(UnrolledListInsertAfter(&list, &it, words[i % HOST_TEST_MODEL_SIZE]) == SUCCESS);
+            memmove(&model[position + 2], &model[position + 1],
+                    (n - position - 1) * sizeof (char *));
+            model[position + 1] = words[i % HOST_TEST_MODEL_SIZE];
+            n++;
+            wrong += (UnrolledListData(&it) != model[position + 1]);
+        } else {
+            wrong += (UnrolledListRemove(&list, &it) != model[position]);
+            memmove(&model[position], &model[position + 1], (n - position - 1) * sizeof (char *));
+            n--;
+            wrong += UnrolledListValid(&it) ? (position == n || UnrolledListData(&it)
+                    != model[position]) : (position != n);
+        }
+        HostTestCheckUnrolled(&list, model, n);
+    }
+    CHECK(wrong == 0);
+
+    // An insert past the end appends, and emptying the list from the front frees every node.
+    HostTestUnrolledAt(&list, &it, n);
+    CHECK(UnrolledListInsertAfter(&list, &it, words[0]) == SUCCESS);
+    model[n++] = words[0];
+    CHECK(it.node == list.tail && UnrolledListData(&it) == words[0]);
+    HostTestCheckUnrolled(&list, model, n);
+    while (n > 0) {
+        HostTestUnrolledAt(&list, &it, 0);
+        CHECK(UnrolledListRemove(&list, &it) == model[0]);
+        memmove(&model[0], &model[1], --n * sizeof (char *));
+        HostTestCheckUnrolled(&list, model, n);
+    }
+    CHECK(list.head == NULL && list.tail == NULL);
+    UnrolledListFree(&list);
+    CHECK(list.head == NULL && list.tail == NULL && UnrolledListSize(&list) == 0);
+}
+
+/**
+ * HostTestJoinArray() is HostTestJoin() for an ArrayList, and also checks its tail and size.
+ */
+static const char *HostTestJoinArray(const ArrayList *list)
+{
+    static char text[HOST_TEST_TEXT_SIZE];
+    uint16_t item, previous = ARRAY_LIST_NONE;
+    int used = 0, size = 0;
+
+    text[0] = '\0';
+    for (item = list->head; item != ARRAY_LIST_NONE; previous = item, item = list->next[item]) {
+        CHECK(list->previous[item] == previous);
+        used += snprintf(&text[used], sizeof (text) - used, "%s%s", used > 0 ? "," : "",
+                list->data[item] == NULL ? "(null)" : list->data[item]);
+        size++;
+    }
+    CHECK(list->tail == previous && ArrayListSize(list) == size);
+    return text;
+}
+
+/**
+ * TestArrayList() checks the free slot chain, inserting into a full list, and that sorting and
+ * counting give what LinkedListSort() and SortedWordCount() give for the same words.
+ */
+static void TestArrayList(void)
+{
+    static ArrayList list;
+    char cow1[] = "cow", cow2[] = "cow";
+    char *words[] = {"pig", cow1, NULL, "a", "turtle", "", "bb", cow2, NULL, "a", "zz", "dog"};
+    int n = sizeof (words) / sizeof (words[0]);
+    char *many[ARRAY_LIST_CAPACITY + 1];
+    char manyWords[ARRAY_LIST_CAPACITY][16];
+    int counts[16], reference[16];
+    LinkedList linked;
+    uint16_t item;
+    int i, inOrder = TRUE;
+
+    // Filling every slot hands them out in order, then the list is full.
+    ArrayListInit(&list);
+    for (i = 0; i < ARRAY_LIST_CAPACITY; i++) {
+        snprintf(manyWords[i], sizeof (manyWords[i]), "s%d", i);
+        inOrder = inOrder && ArrayListCreateAfter(&list, list.tail, manyWords[i]) == i;
+    }
+    CHECK(inOrder);
+    CHECK(ArrayListCreateAfter(&list, list.head, "x") == ARRAY_LIST_NONE);
+    CHECK(ArrayListSize(&list) == ARRAY_LIST_CAPACITY);
+
+    // Removed slots are reused last in, first out, and only those.
+    CHECK(strcmp(ArrayListRemove(&list, 5), "s5") == 0);
+    CHECK(strcmp(ArrayListRemove(&list, 40), "s40") == 0);
+    CHECK(strcmp(ArrayListRemove(&list, list.head), "s0") == 0);
+    CHECK(strcmp(ArrayListRemove(&list, list.tail), "s63") == 0);
+    CHECK(ArrayListRemove(&list, ARRAY_LIST_NONE) == NULL);
+    CHECK(ArrayListSize(&list) == ARRAY_LIST_CAPACITY - 4);
+    CHECK(ArrayListCreateAfter(&list, ARRAY_LIST_NONE, "head") == ARRAY_LIST_CAPACITY - 1);
+    CHECK(ArrayListCreateAfter(&list, 4, "after4") == 0);
+    CHECK(ArrayListCreateAfter(&list, list.tail, "tail") == 40);
+    CHECK(ArrayListCreateAfter(&list, 39, "after39") == 5);
+    CHECK(ArrayListCreateAfter(&list, 39, "full") == ARRAY_LIST_NONE);
+    CHECK(strncmp(HostTestJoinArray(&list), "head,s1,s2,s3,s4,after4,s6,", 27) == 0);
+    CHECK(strstr(HostTestJoinArray(&list), ",s38,s39,after39,s41,") != NULL);
+    CHECK(strstr(HostTestJoinArray(&list), ",s61,s62,tail") != NULL);
+    for (i = 0; i <= ARRAY_LIST_CAPACITY; i++) {
+        many[i] = manyWords[0];
+    }
+    CHECK(ArrayListFromArray(&list, many, ARRAY_LIST_CAPACITY + 1) == SIZE_ERROR);
+
+    // Sorting and counting against the ListItem versions.
+    CHECK(ArrayListFromArray(&list, words, n) == SUCCESS);
+    CHECK(ArrayListSortedWordCount(&list, counts) == STANDARD_ERROR);
+    CHECK(ArrayListSort(&list) == SUCCESS);
+    CHECK(ArrayListSortedWordCount(&list, counts) == SUCCESS);
+    HostTestBuild(&linked, words, n);
+    LinkedListSort(linked.head);
+    CHECK(SortedWordCount(linked.head, reference) == SUCCESS);
+    CHECK(strcmp(HostTestJoinArray(&list), HostTestJoin(linked.head)) == 0);
+    CHECK(HostTestSameCounts(counts, reference, n));
+    HostTestFree(&linked);
+    HostTestForgetWords();
+
+    // The sort is stable and leaves every element in its slot.
+    for (item = list.head; item != ARRAY_LIST_NONE && list.data[item] != cow1;
+            item = list.next[item]);
+    CHECK(item == 1 && list.data[list.next[item]] == cow2);
+    CHECK(ArrayListSort(NULL) == STANDARD_ERROR && ArrayListSortedWordCount(NULL, counts)
+            == STANDARD_ERROR);
+}
+
+/**
+ * HostTestCheckIndex() compares every SkipList lookup on index against a walk over its list.
+ */
+static void HostTestCheckIndex(const SkipList *index, LinkedList *list, char **probes, int n)
+{
+    ListItem probe, *item, *lower;
+    int i, count;
+    for (i = 0; i < n; i++) {
+        LinkedListInitProbe(&probe, probes[i]);
+        lower = NULL;
+        count = 0;
+        for (item = list->head; item != NULL; item = item->nextItem) {
+            if (lower == NULL && LinkedListCompare(item, &probe) >= 0) {
+                lower = item;
+            }
+            count += (LinkedListCompare(item, &probe) == 0);
+        }
+        CHECK(SkipListLowerBound(index, probes[i]) == lower);
+        CHECK(SkipListFind(index, probes[i]) == (count > 0 ? lower : NULL));
+        CHECK(SkipListCount(index, probes[i]) == count);
+    }
+}
+
+/**
+ * HostTestCheckWordCounts() checks LinkedListWordCount() at every position of the list of header
+ * against UnsortedWordCount(), and checks the header too. It must be the only list alive.
+ */
+static void HostTestCheckWordCounts(const LinkedList *header)
+{
+    int reference[2 * WORD_TABLE_CAPACITY];
+    ListItem *item;
+    int i, same = TRUE;
+
+    HostTestHeader(header);
+    CHECK(header->size <= 2 * WORD_TABLE_CAPACITY);
+    CHECK(UnsortedWordCount(header->head, reference) == SUCCESS);
+    for (item = header->head, i = 0; item != NULL; item = item->nextItem, i++) {
+        same = same && LinkedListWordCount(item) == reference[i];
+    }
+    CHECK(same);
+}
+
+/**
+ * HostTestItemAt() returns the ListItem at position of the list of header.
+ */
+static ListItem *HostTestItemAt(const LinkedList *header, int position)
+{
+    ListItem *item = header->head;
+    for (; position > 0 && item != NULL; position--) {
+        item = item->nextItem;
+    }
+    return item;
+}
+
+/**
+ * TestWordCount() checks LinkedListWordCount() after every kind of change that moves the first
+ * occurrence of a word, and with more distinct words than the intern table takes.
+ */
+static void TestWordCount(void)
+{
+    char *words[] = {"cow", "a", NULL, "cow", "bb", "a", "cow", "dog"};
+    char *others[] = {"bb", NULL, "cow", "eel"};
+    char manyWords[WORD_TABLE_CAPACITY][16];
+    LinkedList list, other;
+    ListItem *lists[2];
+    int i;
+#ifdef LINKED_LIST_INTERN
+    ListItem *item;
+    int uninterned = 0;
+#endif
+
+    HostTestBuild(&list, words, 8);
+    HostTestCheckWordCounts(&list);
+
+    // New first occurrences in the middle, before the old ones, and of a new word.
+    CHECK(LinkedListCreateAfter(list.head, "a") != NULL);
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListCreateAfter(HostTestItemAt(&list, 3), "bb") != NULL);
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListCreateAfter(HostTestItemAt(&list, 5), "emu") != NULL);
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListCreateAfter(list.tail, "cow") != NULL);
+    HostTestCheckWordCounts(&list);
+
+    // Data changes away from and onto first occurrences, and swaps.
+    CHECK(LinkedListSetData(list.head, "dog") == SUCCESS);
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListSetData(HostTestItemAt(&list, 6), NULL) == SUCCESS);
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListSetData(HostTestItemAt(&list, 3), "a") == SUCCESS);
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListSwapData(list.head, list.tail) == SUCCESS);
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListSwapData(HostTestItemAt(&list, 1), HostTestItemAt(&list, 7)) == SUCCESS);
+    HostTestCheckWordCounts(&list);
+
+    // Relinking by sorting, inserting into the sorted list and freeing a range.
+    CHECK(LinkedListSort(list.head) == SUCCESS);
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListInsertSorted(&list, "a") != NULL);
+    CHECK(LinkedListInsertSorted(&list, NULL) != NULL);
+    CHECK(LinkedListInsertSorted(&list, "cow") != NULL);
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListFreeRange(HostTestItemAt(&list, 3), HostTestItemAt(&list, 6), NULL)
+            == SUCCESS);
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListFreeRange(list.head, list.head, NULL) == SUCCESS);
+    HostTestCheckWordCounts(&list);
+
+    // Merging into another list, then changing and sorting the merged list.
+    HostTestBuild(&other, others, 4);
+    CHECK(LinkedListSort(other.head) == SUCCESS);
+    lists[0] = other.head;
+    lists[1] = list.head;
+    CHECK(LinkedListMergeSorted(lists, 2) == other.head);
+    HostTestCheckWordCounts(&other);
+    CHECK(LinkedListSetData(other.tail, "a") == SUCCESS);
+    CHECK(LinkedListSort(other.head) == SUCCESS);
+    HostTestCheckWordCounts(&other);
+    HostTestFree(&other);
+    HostTestForgetWords();
+
+    // More distinct words than the intern table takes, every one twice, then changed.
+    LinkedListInit(&list);
+    for (i = 0; i < 2 * WORD_TABLE_CAPACITY; i++) {
+        snprintf(manyWords[i % WORD_TABLE_CAPACITY], sizeof (manyWords[0]), "m%d",
+                i % WORD_TABLE_CAPACITY);
+        CHECK(LinkedListAppend(&list, manyWords[i % WORD_TABLE_CAPACITY]) != NULL);
+    }
+#ifdef LINKED_LIST_INTERN
+    for (item = list.head; item != NULL; item = item->nextItem) {
+        uninterned += item->wordId == 0;
+    }
+    CHECK(uninterned > 0 && uninterned < list.size);
+#endif
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListSetData(list.head, list.tail->data) == SUCCESS);
+    CHECK(LinkedListSetData(list.tail, NULL) == SUCCESS);
+    CHECK(LinkedListCreateAfter(list.head, list.head->nextItem->data) != NULL);
+    CHECK(LinkedListFreeRange(HostTestItemAt(&list, 10), HostTestItemAt(&list, 70), NULL)
+            == SUCCESS);
+    HostTestCheckWordCounts(&list);
+    CHECK(LinkedListSort(list.head) == SUCCESS);
+    HostTestCheckWordCounts(&list);
+    HostTestFree(&list);
+    HostTestForgetWords();
+}
+
+/**
+ * TestFootprint() checks every bucket of LinkedListGetFootprint() on a list mixing a block with
+ * single ListItems, and with LINKED_LIST_HEAP_RESERVE that ListItems come from the heap until the
+ * reserve is reached and from the pool after that.
+ */
+static void TestFootprint(void)
+{
+    char *words[] = {"cow", NULL, "bb"};
+    const int heapItem = sizeof (ListItem) + LINKED_LIST_HEAP_OVERHEAD;
+    LinkedListPoolStats before, after;
+    LinkedListFootprint footprint;
+    LinkedList list;
+    ListItem *block, *item;
+    int fromPool;
+
+    // A block of three followed by two single ListItems.
+    LinkedListGetPoolStats(&before);
+    block = LinkedListFromArray(words, 3);
+    CHECK(block != NULL);
+    item = LinkedListCreateAfter(&block[2], "a");
+    CHECK(LinkedListCreateAfter(item, "ddd") != NULL);
+    CHECK(LinkedListGetFootprint(item, &footprint) == SUCCESS);
+    LinkedListGetPoolStats(&after);
+    // Only a pool without a reserve has the single ListItems, the heap is nearly empty here.
+    fromPool = LINKED_LIST_POOL_SIZE > 0 && LINKED_LIST_HEAP_RESERVE == 0 ? 2 : 0;
+    CHECK(footprint.items == 5 && footprint.dataBytes == 4 + 3 + 2 + 4);
+    CHECK(footprint.blockBytes == 3 * (int) sizeof (ListItem));
+    CHECK(footprint.poolBytes == fromPool * (int) sizeof (ListItem));
+    CHECK(footprint.heapBytes == (2 - fromPool) * heapItem);
+    CHECK(after.heapBytes - before.heapBytes == footprint.heapBytes + footprint.blockBytes
+            + LINKED_LIST_HEAP_OVERHEAD);
+    CHECK(after.inUse - before.inUse == 5);
+    CHECK(LinkedListFreeArray(block, 3) == SUCCESS);
+    CHECK(LinkedListGetFootprint(item, &footprint) == SUCCESS);
+    CHECK(footprint.items == 2 && footprint.blockBytes == 0 && footprint.dataBytes == 2 + 4);
+    CHECK(LinkedListFreeAll(item, NULL) == SUCCESS);
+    CHECK(LinkedListGetFootprint(NULL, &footprint) == SUCCESS && footprint.items == 0);
+    CHECK(LinkedListGetFootprint(NULL, NULL) == STANDARD_ERROR);
+    LinkedListGetPoolStats(&after);
+    CHECK(after.heapBytes == before.heapBytes && after.inUse == before.inUse);
+
+#if LINKED_LIST_POOL_SIZE > 0 && LINKED_LIST_HEAP_RESERVE > 0
+    // Fill the heap down to the reserve, a few more come from the pool.
+    LinkedListInit(&list);
+    do {
+        CHECK(LinkedListAppend(&list, "e") != NULL);
+        LinkedListGetPoolStats(&after);
+    } while (after.fallbacks == before.fallbacks && list.size < LINKED_LIST_HEAP_SIZE);
+    CHECK(after.fallbacks == before.fallbacks + 1);
+    CHECK(LINKED_LIST_HEAP_SIZE - after.heapBytes >= LINKED_LIST_HEAP_RESERVE);
+    CHECK(LINKED_LIST_HEAP_SIZE - after.heapBytes - heapItem < LINKED_LIST_HEAP_RESERVE);
+    CHECK(LinkedListAppend(&list, NULL) != NULL && LinkedListAppend(&list, "ff") != NULL);
+    CHECK(LinkedListGetFootprint(list.head, &footprint) == SUCCESS);
+    LinkedListGetPoolStats(&after);
+    CHECK(after.fallbacks == before.fallbacks + 3);
+    CHECK(footprint.items == list.size && footprint.blockBytes == 0);
+    CHECK(footprint.poolBytes == 3 * (int) sizeof (ListItem));
+    CHECK(footprint.heapBytes == (list.size - 3) * heapItem);
+    CHECK(footprint.heapBytes == after.heapBytes - before.heapBytes);
+    CHECK(footprint.dataBytes == 2 * (list.size - 2) + 3);
+
+    // Freeing a heap ListItem makes room for the next one on the heap again.
+    LinkedListRemove(list.head);
+    CHECK(LinkedListAppend(&list, "e") != NULL);
+    LinkedListGetPoolStats(&after);
+    CHECK(after.fallbacks == before.fallbacks + 3);
+    HostTestFree(&list);
+    LinkedListGetPoolStats(&after);
+    CHECK(after.heapBytes == before.heapBytes && after.inUse == before.inUse);
+#else
+    (void) list;
+#endif
+    HostTestForgetWords();
+}
+
+/**
+ * HostTestCompareRecords() orders HostTestRecords by key only, so that equal keys test stability.
+ */
+static int HostTestCompareRecords(const ListNode *first, const ListNode *second)
+{
+    return LIST_NODE_ENTRY(first, HostTestRecord, node)->key
+            - LIST_NODE_ENTRY(second, HostTestRecord, node)->key;
+}
+
+/**
+ * TestIntrusiveList() checks inserting, removing and sorting records through embedded ListNodes.
+ */
+static void TestIntrusiveList(void)
+{
+    HostTestRecord records[HOST_TEST_MODEL_SIZE];
+    ListNode *node, *previous;
+    int i, size, same = TRUE;
+
+    for (i = 0; i < HOST_TEST_MODEL_SIZE; i++) {
+        records[i].key = HostTestRandom() % 10;
+        records[i].position = i;
+        ListNodeInit(&records[i].node);
+        if (i > 0) {
+            CHECK(ListNodeInsertAfter(&records[i - 1].node, &records[i].node) == SUCCESS);
+        }
+    }
+    CHECK(ListNodeSize(&records[9].node) == HOST_TEST_MODEL_SIZE);
+    CHECK(ListNodeGetFirst(&records[9].node) == &records[0].node);
+    CHECK(ListNodeGetLast(&records[9].node) == &records[HOST_TEST_MODEL_SIZE - 1].node);
+    CHECK(LIST_NODE_ENTRY(&records[5].node, HostTestRecord, node) == &records[5]);
+
+    // Remove the head, a middle node and the tail, and put one back in the middle.
+    CHECK(ListNodeRemove(&records[0].node) == SUCCESS);
+    CHECK(ListNodeRemove(&records[30].node) == SUCCESS);
+    CHECK(ListNodeRemove(&records[HOST_TEST_MODEL_SIZE - 1].node) == SUCCESS);
+    CHECK(records[29].node.next == &records[31].node && records[31].node.previous
+            == &records[29].node);
+    CHECK(ListNodeSize(&records[0].node) == 1 && ListNodeSize(&records[1].node)
+            == HOST_TEST_MODEL_SIZE - 3);
+    CHECK(ListNodeInsertAfter(&records[10].node, &records[30].node) == SUCCESS);
+    CHECK(records[10].node.next == &records[30].node && records[11].node.previous
+            == &records[30].node);
+    records[30].position = 10;
+
+    // A stable sort by key: keys ascend, and equal keys keep their positions in order.
+    node = ListNodeSort(&records[40].node, HostTestCompareRecords);
+    CHECK(node != NULL && node->previous == NULL);
+    for (size = 0, previous = NULL; node != NULL; previous = node, node = node->next, size++) {
+        same = same && node->previous == previous;
+        if (previous != NULL) {
+            HostTestRecord *before = LIST_NODE_ENTRY(previous, HostTestRecord, node);
+            HostTestRecord *record = LIST_NODE_ENTRY(node, HostTestRecord, node);
+            same = same && (before->key < record->key || (before->key == record->key
+                    && before->position <= record->position));
+        }
+    }
+    CHECK(same && size == HOST_TEST_MODEL_SIZE - 2);
+    CHECK(ListNodeSort(NULL, HostTestCompareRecords) == NULL);
+    CHECK(ListNodeSort(&records[1].node, NULL) == NULL);
+    CHECK(ListNodeInsertAfter(NULL, NULL) == STANDARD_ERROR && ListNodeRemove(NULL)
+            == STANDARD_ERROR);
+}
+
+/**
+ * TestSkipList() checks lookups against a linear walk, also with indexes that have to share the
+ * node pool.
+ */
+static void TestSkipList(void)
+{
+    char *words[] = {"ab", "a", "ddd", "b", "ab", NULL, "ca", "ab", "b", "zz", "e", "ddd", "f",
+        "gg", "a", "hh", "ii", "j", "k", "ab"};
+    char *probes[] = {NULL, "", "a", "aa", "ab", "b", "c", "ddd", "zz", "zzz", "zzzz"};
+    int n = sizeof (words) / sizeof (words[0]);
+    char *otherProbes[] = {"w00", "w17", "w41", "w42", "a"};
+    char otherWords[42][16];
+    LinkedList list, other;
+    SkipList index, otherIndex;
+    int i, stride;
+
+    HostTestBuild(&list, words, n);
+    LinkedListSort(list.head);
+    CHECK(SkipListBuild(&index, list.head) == SUCCESS);
+    CHECK(index.size == n);
+    HostTestCheckIndex(&index, &list, probes, sizeof (probes) / sizeof (probes[0]));
+    stride = index.stride;
+
+    // A second index while the first still holds its nodes, which leaves the pool too small for
+    // a stride of 2 if it has the default size.
+    LinkedListInit(&other);
+    for (i = 0; i < 42; i++) {
+        snprintf(otherWords[i], sizeof (otherWords[i]), "w%02d", i);
+        CHECK(LinkedListAppend(&other, otherWords[i]) != NULL);
+    }
+    CHECK(SkipListBuild(&otherIndex, other.head) == SUCCESS);
+    CHECK(otherIndex.size == 42);
+    HostTestCheckIndex(&otherIndex, &other, otherProbes, sizeof (otherProbes) /
+            sizeof (otherProbes[0]));
+    HostTestCheckIndex(&index, &list, probes, sizeof (probes) / sizeof (probes[0]));
+    SkipListClear(&otherIndex);
+    SkipListClear(&index);
+    HostTestFree(&other);
+
+    // Every node is back in the pool.
+    CHECK(SkipListBuild(&index, list.head) == SUCCESS);
+    CHECK(index.stride == stride);
+    SkipListClear(&index);
+
+    // An empty index.
+    CHECK(SkipListBuild(&index, NULL) == SUCCESS);
+    CHECK(SkipListFind(&index, "a") == NULL && SkipListCount(&index, "a") == 0);
+    SkipListClear(&index);
+    CHECK(SkipListBuild(NULL, list.head) == STANDARD_ERROR);
+    HostTestFree(&list);
+    HostTestForgetWords();
+}
+
+/**
+ * HostTestSign() returns -1, 0 or 1 for a negative, zero or positive number.
+ */
+static int HostTestSign(int number)
+{
+    return (number > 0) - (number < 0);
+}
+
+/**
+ * TestFastString() checks FastStringLength() against strlen() and FastStringCompare() against
+ * memcmp() at every alignment, for lengths around the word size and differences at every place.
+ */
+static void TestFastString(void)
+{
+    // Words keep both buffers aligned, so that offsets 0 to 3 cover every alignment.
+    static uint32_t firstWords[16], secondWords[16];
+    char *first = (char *) firstWords, *second = (char *) secondWords;
+    int offset, other, length, place, same = TRUE;
+
+    for (offset = 0; offset < 4; offset++) {
+        for (length = 0; length < 40; length++) {
+            memset(first, 'x', sizeof (firstWords));
+            first[offset + length] = '\0';
+            same = same && FastStringLength(&first[offset]) == length;
+        }
+    }
+    CHECK(same);
+
+    for (offset = 0; offset < 4; offset++) {
+        for (other = 0; other < 4; other++) {
+            for (length = 0; length < 12; length++) {
+                // place == length means the strings are equal.
+                for (place = 0; place <= length; place++) {
+                    memset(first, 'm', sizeof (firstWords));
+                    memset(second, 'm', sizeof (secondWords));
+                    if (place < length) {
+                        first[offset + place] = (place % 2) ? 'a' : '\xf0';
+                    }
+                    same = same && HostTestSign(FastStringCompare(&first[offset], &second[other],
+                            length)) == HostTestSign(memcmp(&first[offset], &second[other],
+                            length));
+                    same = same && HostTestSign(FastStringCompare(&second[other], &first[offset],
+                            length)) == HostTestSign(memcmp(&second[other], &first[offset],
+                            length));
+                }
+            }
+        }
+    }
+    CHECK(same);
+}
+
+/**
+ * TestWordStream() checks splitting received text into words, including across the end of the
+ * ring, and that words that are too long are dropped.
+ */
+static void TestWordStream(void)
+{
+    char longWord[WORD_STREAM_MAX_WORD_LENGTH + 2];
+    char text[16];
+    LinkedList list;
+    int i, sent, words = 0, wrong = 0;
+
+    HostTestForgetWords();
+    UartQueueInit();
+    WordStreamInit();
+    LinkedListInit(&list);
+    HostTestReceive("one two  three", 14);
+    CHECK(WordStreamPoll(&list) == 2);
+    CHECK(strcmp(HostTestJoin(list.head), "one,two") == 0);
+    HostTestReceive("\n", 1);
+    CHECK(WordStreamPoll(&list) == 1);
+    CHECK(strcmp(HostTestJoin(list.head), "one,two,three") == 0);
+    HostTestFree(&list);
+    HostTestForgetWords();
+    WordStreamRelease();
+
+    // Enough words to wrap around the end of the ring several times.
+    for (i = 0; i < 4 * WORD_STREAM_BUFFER_SIZE / 6; i++) {
+        snprintf(text, sizeof (text), "w%04d ", i);
+        HostTestReceive(text, 6);
+        if (WordStreamPoll(&list) == 1) {
+            snprintf(text, sizeof (text), "w%04d", i);
+            wrong += (strcmp(list.head->data, text) != 0);
+            words++;
+        }
+        HostTestFree(&list);
+        HostTestForgetWords();
+        WordStreamRelease();
+    }
+    CHECK(words == 4 * WORD_STREAM_BUFFER_SIZE / 6 && wrong == 0);
+
+    // A word over the limit is dropped and the stream carries on after it.
+    memset(longWord, 'x', sizeof (longWord) - 1);
+    longWord[sizeof (longWord) - 1] = ' ';
+    HostTestReceive(longWord, sizeof (longWord));
+    HostTestReceive("ok ", 3);
+    CHECK(WordStreamPoll(&list) == 1);
+    CHECK(strcmp(HostTestJoin(list.head), "ok") == 0);
+    CHECK(WordStreamDropped() == 1);
+    HostTestFree(&list);
+    HostTestForgetWords();
+    WordStreamRelease();
+
+    // A token longer than the ring, arriving a little at a time, must not stall the stream.
+    memset(text, 'y', 10);
+    sent = txUsed;
+    for (i = 0; i < 30; i++) {
+        HostTestReceive(text, 10);
+        CHECK(WordStreamPoll(&list) == 0);
+        WordStreamRelease();
+    }
+    HostTestReceive(" hello world ", 13);
+    CHECK(WordStreamPoll(&list) == 2);
+    CHECK(strcmp(HostTestJoin(list.head), "hello,world") == 0);
+    CHECK(WordStreamDropped() == 2);
+    CHECK(memchr(&txText[sent], WORD_STREAM_XOFF, txUsed - sent) == NULL);
+    HostTestFree(&list);
+    HostTestForgetWords();
+    WordStreamRelease();
+}
+
+/**
+ * TestDictionary() checks lookups in the generated table and that lists built from it are sorted.
+ */
+static void TestDictionary(void)
+{
+    int counts[] = {0, 2, 1, 2, 1, 0, 3};
+    LinkedList list, sorted;
+    ListItem probe, *item;
+    int i;
+
+    for (i = 0; i < dictionarySize; i++) {
+        CHECK(DictionaryFind(dictionary[i].word) == dictionary[i].id);
+        LinkedListInitProbe(&probe, (char *) dictionary[i].word);
+        CHECK(probe.length == dictionary[i].length && probe.sortKey == dictionary[i].sortKey);
+    }
+    CHECK(DictionaryFind("cats") == 0 && DictionaryFind("") == 0 && DictionaryFind(NULL) == 0);
+    CHECK(DictionaryBuildList(&list, counts) == SUCCESS);
+    CHECK(strcmp(HostTestJoin(list.head), "cow,cow,dog,pig,pig,bird,turtle,turtle,turtle") == 0);
+    CHECK(list.sorted);
+    HostTestHeader(&list);
+    for (item = list.head; item != NULL; item = item->nextItem) {
+        LinkedListInitProbe(&probe, item->data);
+        CHECK(item->length == probe.length && item->sortKey == probe.sortKey);
+    }
+
+    // The same words appended in another order and sorted end up the same.
+    LinkedListInit(&sorted);
+    for (item = list.tail; item != NULL; item = item->previousItem) {
+        LinkedListAppend(&sorted, item->data);
+    }
+    LinkedListSort(sorted.head);
+    CHECK(strcmp(HostTestJoin(sorted.head), HostTestJoin(list.head)) == 0);
+    for (item = list.head; item != NULL; item = item->nextItem) {
+        CHECK(item->nextItem == NULL || LinkedListCompare(item, item->nextItem) <= 0);
+    }
+    HostTestFree(&list);
+    HostTestFree(&sorted);
+    HostTestForgetWords();
+}
+
+/**
+ * TestTopK() checks finding the most frequent words, and their order on ties, also in lists with
+ * more distinct words than a WordTable takes.
+ */
+static void TestTopK(void)
+{
+    char *words[] = {"b", "dd", NULL, "a", "dd", "b", NULL, NULL, "c", "dd", "a", "ee"};
+    char manyWords[2 * WORD_TABLE_CAPACITY][16];
+    ListItem *firsts[2 * WORD_TABLE_CAPACITY];
+    LinkedListTopWord top[2 * WORD_TABLE_CAPACITY];
+    int counts[12], reference[12];
+    LinkedList list, many;
+    int i, distinct, nulls;
+
+    HostTestBuild(&list, words, 12);
+    CHECK(LinkedListTopK(list.tail, 3, top) == 3);
+    CHECK(top[0].count == 3 && strcmp(top[0].item->data, "dd") == 0);
+    CHECK(top[0].item == list.head->nextItem);
+    CHECK(top[1].count == 2 && strcmp(top[1].item->data, "a") == 0);
+    CHECK(top[2].count == 2 && strcmp(top[2].item->data, "b") == 0);
+    CHECK(LinkedListTopK(list.head, 8, top) == 5);
+    CHECK(top[3].count == 1 && strcmp(top[3].item->data, "c") == 0);
+    CHECK(top[4].count == 1 && strcmp(top[4].item->data, "ee") == 0);
+    CHECK(LinkedListTopK(list.head, 0, top) == 0 && LinkedListTopK(NULL, 3, top) == 0);
+    CHECK(strcmp(HostTestJoin(list.head), "b,dd,(null),a,dd,b,(null),(null),c,dd,a,ee") == 0);
+
+    // More distinct words than the table takes, at first without and then with the sorting
+    // fallback under test-intern, and always with it otherwise.
+    for (distinct = WORD_TABLE_CAPACITY; distinct <= 2 * WORD_TABLE_CAPACITY; distinct *= 2) {
+        LinkedListInit(&many);
+        for (i = 0, nulls = 0; i < distinct; i++) {
+            snprintf(manyWords[i], sizeof (manyWords[i]), "m%d", i);
+            nulls += i % 10 == 5;
+            firsts[i] = LinkedListAppend(&many, i % 10 == 5 ? NULL : manyWords[i]);
+        }
+        for (i = 0; i < 6; i++) {
+            LinkedListAppend(&many, manyWords[i < 3 ? 7 : (i < 5 ? 20 : distinct - 1)]);
+        }
+        CHECK(LinkedListTopK(many.tail, 4, top) == 4);
+        CHECK(top[0].item == firsts[7] && top[0].count == 4);
+        CHECK(top[1].item == firsts[20] && top[1].count == 3);
+        CHECK(top[2].item == firsts[distinct - 1] && top[2].count == 2);
+        CHECK(top[3].item == firsts[0] && top[3].count == 1);
+        CHECK(LinkedListTopK(many.head, 2 * WORD_TABLE_CAPACITY, top) == distinct - nulls);
+        CHECK(top[3].item == firsts[0] && top[distinct - nulls - 1].count == 1);
+        HostTestHeader(&many);
+        CHECK(many.size == distinct + 6);
+        HostTestFree(&many);
+    }
+
+    // The shared table must be empty again for the next call and for the word counts.
+    CHECK(LinkedListTopK(list.head, 8, top) == 5);
+    CHECK(top[0].count == 3 && top[4].count == 1 && strcmp(top[4].item->data, "ee") == 0);
+    CHECK(UnsortedWordCount(list.head, reference) == SUCCESS);
+    CHECK(UnsortedWordCountHashed(list.head, counts) == SUCCESS);
+    CHECK(HostTestSameCounts(counts, reference, 12));
+    HostTestFree(&list);
+    HostTestForgetWords();
+}
+
+/**
+ * TestPrintQueued() checks the text queued for the UART, including for a list that needs the
+ * transmit buffer several times over.
+ */
+static void TestPrintQueued(void)
+{
+    char *words[] = {"a", NULL, "bb"};
+    char expected[HOST_TEST_TEXT_SIZE];
+    LinkedListPrintState state;
+    LinkedList list;
+    int i, used, calls;
+
+    UartQueueInit();
+    HostTestBuild(&list, words, 3);
+    CHECK(LinkedListPrintQueuedBegin(&state, list.tail) == SUCCESS);
+    CHECK(LinkedListPrintQueued(&state) == TRUE);
+    CHECK(strcmp(txText, "{-a--(null)--bb-}\n") == 0);
+    CHECK(LinkedListPrintQueued(&state) == TRUE);
+    CHECK(strcmp(txText, "{-a--(null)--bb-}\n") == 0);
+    CHECK(LinkedListPrintQueuedBegin(&state, NULL) == STANDARD_ERROR);
+    CHECK(LinkedListPrintQueuedBegin(NULL, list.head) == STANDARD_ERROR);
+    HostTestDrain();
+    HostTestFree(&list);
+
+    // Far more text than the transmit buffer holds, with breaks in the middle of words.
+    UartQueueInit();
+    LinkedListInit(&list);
+    used = snprintf(expected, sizeof (expected), "{");
+    for (i = 0; i < 200; i++) {
+        LinkedListAppend(&list, (i % 7 == 0) ? NULL : "word");
+        used += snprintf(&expected[used], sizeof (expected) - used, "%s",
+                (i % 7 == 0) ? "-(null)-" : "-word-");
+    }
+    snprintf(&expected[used], sizeof (expected) - used, "}\n");
+    CHECK(LinkedListPrintQueuedBegin(&state, list.head) == SUCCESS);
+    for (calls = 1; !LinkedListPrintQueued(&state) && calls < 100; calls++) {
+        CHECK(UartQueueFree() == 0);
+        HostTestDrain();
+    }
+    CHECK(calls > 1 && calls < 100);
+    CHECK(strcmp(txText, expected) == 0);
+    HostTestDrain();
+    HostTestFree(&list);
+    HostTestForgetWords();
+}
+
+int main()
+{
+    BOARD_Init();
+
+    TestSort();
+    TestCachedLength();
+    TestUnsortedWordCount();
+    TestSortedWordCount();
+    TestFreeRange();
+    TestPrintQueued();
+    TestSortKey();
+    TestSortRadix();
+    TestSwapData();
+    TestSkipList();
+    TestIntrusiveList();
+    TestUnrolledList();
+    TestArrayList();
+    TestFastString();
+    TestWordStream();
+    TestWordCount();
+    TestSortStep();
+    TestSpliceSplitConcat();
+    TestMergeSorted();
+    TestUniqueCount();
+    TestDictionary();
+    TestFootprint();
+    TestTopK();
+
+    LinkedListPoolStats stats;
+    LinkedListGetPoolStats(&stats);
+    CHECK(stats.inUse == 0);
+    printf("%d checks, %d failed\n", checks, failures);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file
+ * This file replaces UartQueue.c in host builds, see host/Makefile. Writes go straight to stdout,
+ * so the queue is always empty, and nothing is ever received, so the RX handler is never called.
+ */
+
+//Standard Libraries
+#include <stdio.h>
+
+//CMPE13 Support Library
+#include "BOARD.h"
+
+// User libraries
+#include "UartQueue.h"
+
+// **** Define any module-level, global, or external variables here ****
+static UartQueueRxHandler rxHandler = NULL;
+
+/**
+ * UartQueueInit() has nothing to set up on the host.
+ */
+void UartQueueInit(void)
+{
+}
+
+/**
+ * UartQueueWrite() writes length bytes of data to stdout.
+ *
+ * @param data The bytes to write.
+ * @param length How many bytes to write.
+ * @return The number of bytes written.
+ */
+int UartQueueWrite(const char *data, int length)
+{
+    if (data == NULL || length <= 0) {
+        return 0;
+    }
+    return fwrite(data, 1, length, stdout);
+}
+
+/**
+ * UartQueueFree() reports the whole queue as free, since writes never wait in it.
+ *
+ * @return One less than UART_QUEUE_TX_SIZE, like an empty queue on the board.
+ */
+int UartQueueFree(void)
+{
+    return UART_QUEUE_TX_SIZE - 1;
+}
+
+/**
+ * UartQueueIdle() always reports that everything has been sent.
+ *
+ * @return TRUE.
+ */
+int UartQueueIdle(void)
+{
+    return TRUE;
+}
+
+/**
+ * UartQueueSetRxHandler() remembers handler, which is never called on the host.
+ *
+ * @param handler The function to call for every received byte. May be NULL.
+ */
+void UartQueueSetRxHandler(UartQueueRxHandler handler)
+{
+    rxHandler = handler;
+}
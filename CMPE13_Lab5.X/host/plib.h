@@ -0,0 +1,10 @@
+#ifndef PLIB_H
+#define PLIB_H
+
+/**
+ * @file
+ * An empty stand-in for the PIC32 peripheral library header for host builds, see host/Makefile.
+ * Only UartQueue.c uses anything from it, and HostUart.c replaces that on the host.
+ */
+
+#endif
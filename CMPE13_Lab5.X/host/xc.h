@@ -0,0 +1,11 @@
+#ifndef XC_H
+#define XC_H
+
+/**
+ * @file
+ * An empty stand-in for the XC32 device header for host builds, see host/Makefile. Only the
+ * PIC32-specific files (UartQueue.c and Benchmark.c) use anything from it, and those are not part of
+ * the host build.
+ */
+
+#endif
@@ -1,4 +1,5 @@
-// Heap size 1024 required!
+// Heap size 1024 required! (Unless LINKED_LIST_POOL_SIZE is defined, see LinkedList.h, which can
+// also take over from the heap when it runs low with LINKED_LIST_HEAP_RESERVE.)
 
 // **** Include libraries here ****
 // Standard libraries
@@ -15,9 +16,11 @@
 
 // User libraries
 #include "LinkedList.h"
+#include "WordTable.h"
 
 // **** Set any macros or preprocessor directives here ****
 //#define LINKED_LIST_TESTING  //comment this out once the LinkedList Library is working
+#define UNSORTED_WORD_LIST_SIZE 10
 
 // **** Declare any data types here ****
 
@@ -34,8 +37,11 @@ static char *crab = "crab";
 // **** Declare any function prototypes here ****
 int InitializeUnsortedWordList(ListItem **unsortedWordList);
 int UnsortedWordCount(ListItem *list, int *wordCount);
+int UnsortedWordCountHashed(ListItem *list, int *wordCount);
 int SortedWordCount(ListItem *list, int *wordCount);
 
+// The benchmark configuration provides its own main(), see Benchmark.c.
+#ifndef LINKED_LIST_BENCHMARK
 int main()
 {
     BOARD_Init();
@@ -52,6 +58,11 @@ int main()
         printf("ERROR: Failed to initialize word list\n");
         while (1);
     }
+    // The list is a single block, remember it so it can be freed in one go.
+    ListItem *wordBlock = unsortedWordList;
+    // Track the list with a header so sizing it and finding its head are O(1).
+    LinkedList wordList;
+    LinkedListAttach(&wordList, unsortedWordList);
     // Print the list
     LinkedListPrint(unsortedWordList);
 
@@ -82,7 +93,7 @@ int main()
 
     //SORTED WORD COUNT
     int dupArray[10];
-    LinkedListGetFirst(sortedWordList);
+    sortedWordList = LinkedListGetFirst(sortedWordList);
     if (SortedWordCount(sortedWordList, dupArray)) {
         printf("[%d, %d, %d, %d, %d, %d, %d, %d, %d, %d]\n",
                 dupArray[0], dupArray[1], dupArray[2],
@@ -96,26 +107,14 @@ int main()
 
 
     //FREEING THE LIST MEMORY
-    ListItem *temp;
-    ListItem *asortedWordList;
-    LinkedListGetFirst(unsortedWordList);
-    for (asortedWordList = unsortedWordList; asortedWordList->nextItem->nextItem != NULL; asortedWordList = asortedWordList->nextItem) {
-        temp = asortedWordList->nextItem;
-        LinkedListRemove(asortedWordList);
-        asortedWordList = temp;
-    }
-    LinkedListGetFirst(sortedWordList);
-    for (asortedWordList = sortedWordList; asortedWordList->nextItem->nextItem != NULL; asortedWordList = asortedWordList->nextItem) {
-        temp = asortedWordList->nextItem;
-        LinkedListRemove(asortedWordList);
-        asortedWordList = temp;
-    }
+    LinkedListFreeArray(wordBlock, UNSORTED_WORD_LIST_SIZE);
     /******************************** Your custom code goes above here ********************************/
 
     // You can never return from main() in an embedded system (one that lacks an operating system).
     // This will result in the processor restarting, which is almost certainly not what you want!
     while (1);
 }
+#endif
 
 #ifndef LINKED_LIST_TESTING
 
@@ -147,8 +146,6 @@ int UnsortedWordCount(ListItem *list, int *wordCount)
     }
 
     char *word1;
-    char *word2;
-    char *repCheck;
     ListItem *item1 = list;
     ListItem *item2;
     int temp, firstOccurencePos;
@@ -172,8 +169,7 @@ int UnsortedWordCount(ListItem *list, int *wordCount)
         item2 = item1->previousItem;
         while (item2 != NULL) {
             --temp;
-            repCheck = (char *) item2->data;
-            if (repCheck != NULL && strcmp(repCheck, word1) == 0) {
+            if (LinkedListEqual(item2, item1)) {
                 repetitionFlag = 1;
                 firstOccurencePos = temp;
             }
@@ -184,8 +180,7 @@ int UnsortedWordCount(ListItem *list, int *wordCount)
         if (repetitionFlag == 0) {
             item2 = LinkedListGetFirst(list);
             while (item2 != NULL) {
-                word2 = (char *) item2->data;
-                if (word2 != NULL && item1 != item2 && strcmp(word1, word2) == 0) {
+                if (item1 != item2 && LinkedListEqual(item1, item2)) {
                     ++j;
                 }
                 item2 = item2->nextItem;
@@ -200,6 +195,63 @@ int UnsortedWordCount(ListItem *list, int *wordCount)
     return SUCCESS;
 }
 
+/**
+ * UnsortedWordCountHashed() produces exactly the same output as UnsortedWordCount() but runs in
+ * linear time. The first pass counts every word in the shared wordTableScratch and remembers where
+ * each word first occurred, parking the table slot of every word in wordCount. The second pass
+ * turns those slots into the final positive or negative counts and empties them again, so no call
+ * clears the whole table. If the list holds more distinct words than the table can take it falls
+ * back to UnsortedWordCount().
+ *
+ * NOTE: This function assumes that wordCount is the same length as list.
+ * @param list A pointer to the head of a doubly-linked list containing unsorted words.
+ * @param wordCount An array of integers. The output of this function is stored here. It must be
+ *                  at least as big as the linked list pointed to be `list` is.
+ * @return Either SUCCESS or STANDARD_ERROR if the head of the doubly-linked list isn't passed.
+ */
+int UnsortedWordCountHashed(ListItem *list, int *wordCount)
+{
+    // Make sure the head of the list was given.
+    if (list->previousItem != NULL) {
+        return STANDARD_ERROR;
+    }
+
+    WordTable *table = &wordTableScratch;
+    WordTableEntry *entry;
+    ListItem *item;
+    int i;
+
+    for (item = list, i = 0; item != NULL; item = item->nextItem, i++) {
+        // Ignore NULL words
+        if (item->data == NULL) {
+            wordCount[i] = -1;
+            continue;
+        }
+        entry = WordTableLookup(table, item->data, item->length, TRUE);
+        if (entry == NULL) {
+            // The shared table must be left empty, and this is about to cost O(n^2) anyway.
+            WordTableClear(table);
+            return UnsortedWordCount(list, wordCount);
+        }
+        if (entry->count++ == 0) {
+            entry->first = i;
+        }
+        wordCount[i] = entry - table->entries;
+    }
+    for (item = list, i = 0; item != NULL; item = item->nextItem, i++) {
+        if (wordCount[i] < 0) {
+            wordCount[i] = 0;
+        } else {
+            entry = &table->entries[wordCount[i]];
+            wordCount[i] = (entry->first == i) ? entry->count : -entry->count;
+            // Emptying the slot leaves count and first for the later items of the word.
+            entry->word = NULL;
+        }
+    }
+    table->used = 0;
+    return SUCCESS;
+}
+
 /**
  * This function initializes a list of ListItems for use when testing the LinkedList implementation
  * and word count algorithms.
@@ -208,42 +260,21 @@ int UnsortedWordCount(ListItem *list, int *wordCount)
  * ListItem *newList;
  * InitializeUnsortedWordList(&newList);
  *
+ * The whole list is allocated as one block, so release it with LinkedListFreeArray() and
+ * UNSORTED_WORD_LIST_SIZE, not by removing items one at a time.
+ *
  * @param unsortedWordList[out] Where to store the pointer to the head of the list.
  * @return SUCCESS if it succeeds, STANDARD_ERROR if it fails to allocate necessary memory.
  */
 int InitializeUnsortedWordList(ListItem **unsortedWordList)
 {
-    ListItem *tmp = LinkedListNew(crab);
+    char *words[UNSORTED_WORD_LIST_SIZE] = {
+        crab, turtle, cat, pig2, bird, cow, dog, NULL, cow, pig1
+    };
+    ListItem *tmp = LinkedListFromArray(words, UNSORTED_WORD_LIST_SIZE);
     if (!tmp) {
         return STANDARD_ERROR;
     }
-    if (!LinkedListCreateAfter(tmp, pig1)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, cow)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, NULL)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, dog)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, cow)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, bird)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, pig2)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, cat)) {
-        return STANDARD_ERROR;
-    }
-    if (!LinkedListCreateAfter(tmp, turtle)) {
-        return STANDARD_ERROR;
-    }
     *unsortedWordList = tmp;
     return SUCCESS;
 }
@@ -262,6 +293,10 @@ int InitializeUnsortedWordList(ListItem **unsortedWordList)
  *     {NULL, "platypus", "giraffe", "", "corvid", "slug", "", NULL, "platypus", "platypus"} ->
  *     [0   , 3         , 1        , 2 , 1       , 1     , -2, 0   , -3        , -3}
  *
+ * Because the list is sorted, equal words sit next to each other, so this is done in a single pass
+ * that finds each run of equal words and fills in its counts in one go, with one comparison per
+ * pair of neighbouring words.
+ *
  * NOTE: This function assumes that wordCount is the same length as list.
  * @param list A pointer to the head of a doubly-linked list containing sorted words.
  * @param wordCount An array of integers. The output of this function is stored here. It must be
@@ -273,46 +308,34 @@ int SortedWordCount(ListItem *list, int *wordCount)
     if (list->previousItem != NULL) {
         return STANDARD_ERROR;
     }
-    int count = 0;
-    int rep = 1;
-    ListItem *temp, *temp1, *temp2;
+    ListItem *item = list;
+    ListItem *runStart;
+    int i = 0;
+    int start, count;
 
-    for (temp = list; temp != NULL; temp = temp->nextItem) {
-        if (temp->data == NULL) {
-            wordCount[count] = 0;
-        } else {
-            for (temp1 = temp->nextItem; temp1 != NULL; temp1 = temp1->nextItem) {
-                if (strcmp(temp->data, temp1->data) == 0) {
-                    rep++;
-                }
-            }
-            wordCount[count] = rep;
-            for (temp2 = temp->nextItem; temp2 != NULL; temp2 = temp2->nextItem) {
-                if (strcmp(temp->data, temp2->data) == 0) {
-                    wordCount[count] = -rep;
-                }
-            }
+    while (item != NULL) {
+        // NULL words never start or extend a run.
+        if (item->data == NULL) {
+            wordCount[i++] = 0;
+            item = item->nextItem;
+            continue;
+        }
+
+        // Find the end of the run of words equal to this one.
+        runStart = item;
+        start = i;
+        do {
+            item = item->nextItem;
+            i++;
+        } while (item != NULL && item->data != NULL && LinkedListEqual(runStart, item));
+
+        // Fill in the whole run at once.
+        count = i - start;
+        wordCount[start] = count;
+        for (start++; start < i; start++) {
+            wordCount[start] = -count;
         }
-        rep = 1;
-        count++;
     }
-    //            if (strcmp(list->data, temp->data) != 0) {
-    //            temp = list;
-    //            repnum = 1;
-    //            wordCount[count] = 1;
-    //        } else if (strcmp(list->data, temp->data) == 0) {
-    //            repnum++;
-    //            dec = count;
-    //            for(rep = 0; rep<repnum; rep++){
-    //                wordCount[dec] = -repnum;
-    //                if (repnum-1==rep){
-    //                    wordCount[dec] = repnum;
-    //                }
-    //                dec--;
-    //            }
-    //        }
-    //        list = list->nextItem;
-    //    }
     return SUCCESS;
 }
 #endif